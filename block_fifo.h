@@ -0,0 +1,318 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file block_fifo.h
+//
+///  @brief This is the block oriented fifo channel for the data inputs of a node
+//
+///  @details
+///		The channel implements the sc_fifo_in_if and sc_fifo_out_if interfaces, so
+///		that it can be used in place of an sc_fifo, plus bulk transfers of blocks
+///		of values with read_n() and write_n(). It has the same delta cycle 
+///		semantic as sc_fifo: the values written become readable after the update
+///		phase, and the data_written and data_read events are notified at most 
+///		once per delta cycle, whatever the number of values transferred. <br>
+///		It is meant for a single reader and a single writer. The values are 
+///		stored in a ring buffer aligned on a cache line, and the read and write
+///		positions are each only modified by one side. As all the SystemC processes
+///		run on the same OS thread, no lock is needed.
+//		
+//==============================================================================
+
+#ifndef __BLOCK_FIFO_H__
+#define __BLOCK_FIFO_H__
+
+#include <systemc.h>
+#include <new>
+#include <algorithm>
+
+#include "constants.h"
+
+
+//======================================================================
+/// @class block_fifo_in_if
+//
+/// @brief input interface of the block fifo with bulk reads
+//
+//======================================================================
+template <class T>
+class block_fifo_in_if : public sc_core::sc_fifo_in_if<T>
+{
+public:
+	/// blocking read of count values
+	virtual void read_n		( T* data, int count ) = 0;
+
+	/// non-blocking read of up to count values, returns the number of values read
+	virtual int nb_read_n	( T* data, int count ) = 0;
+};
+
+
+//======================================================================
+/// @class block_fifo_out_if
+//
+/// @brief output interface of the block fifo with bulk writes
+//
+//======================================================================
+template <class T>
+class block_fifo_out_if : public sc_core::sc_fifo_out_if<T>
+{
+public:
+	/// blocking write of count values
+	virtual void write_n	( const T* data, int count ) = 0;
+
+	/// non-blocking write of up to count values, returns the number of values written
+	virtual int nb_write_n	( const T* data, int count ) = 0;
+};
+
+
+//======================================================================
+/// @class block_fifo
+//
+/// @brief block oriented fifo channel
+//
+//======================================================================
+template <class T>
+class block_fifo	: public block_fifo_in_if<T>
+					, public block_fifo_out_if<T>
+					, public sc_core::sc_prim_channel
+{
+public:
+
+	explicit block_fifo	( const char* name_,								///< channel name
+						  int size_ = 16									///< number of values the channel can hold
+						)
+		: sc_core::sc_prim_channel( name_ )
+		, bf_size			( size_ )
+		, bf_raw			( 0 )
+		, bf_buf			( 0 )
+		, bf_ri				( 0 )
+		, bf_wi				( 0 )
+		, bf_num_readable	( 0 )
+		, bf_num_read		( 0 )
+		, bf_num_written	( 0 )
+		, bf_update_pending	( false )
+	{
+		// ring buffer aligned on a cache line
+		bf_raw	= new char[ size_t(bf_size) * sizeof(T) + cache_line_size ];
+		bf_buf	= reinterpret_cast<T*>( ( reinterpret_cast<size_t>(bf_raw) + cache_line_size - 1 ) & ~size_t(cache_line_size - 1) );
+		for ( int i = 0; i < bf_size; i++ )
+		{
+			new ( &bf_buf[i] ) T();
+		}
+	}
+
+	~block_fifo	( void )
+	{
+		for ( int i = 0; i < bf_size; i++ )
+		{
+			bf_buf[i].~T();
+		}
+		delete [] bf_raw;
+	}
+
+// sc_fifo_in_if ===============================================================
+	void read ( T& value )
+	{
+		while ( num_available() == 0 )
+		{
+			sc_core::wait( bf_data_written_event );
+		}
+		nb_read_n( &value, 1 );
+	}
+
+	T read ( void )
+	{
+		T value;
+		read( value );
+		return value;
+	}
+
+	bool nb_read ( T& value )
+	{
+		return nb_read_n( &value, 1 ) == 1;
+	}
+
+	int num_available ( void ) const
+	{
+		return bf_num_readable - bf_num_read;
+	}
+
+	const sc_core::sc_event& data_written_event ( void ) const
+	{
+		return bf_data_written_event;
+	}
+
+// sc_fifo_out_if ==============================================================
+	void write ( const T& value )
+	{
+		while ( num_free() == 0 )
+		{
+			sc_core::wait( bf_data_read_event );
+		}
+		nb_write_n( &value, 1 );
+	}
+
+	bool nb_write ( const T& value )
+	{
+		return nb_write_n( &value, 1 ) == 1;
+	}
+
+	int num_free ( void ) const
+	{
+		return bf_size - bf_num_readable - bf_num_written;
+	}
+
+	const sc_core::sc_event& data_read_event ( void ) const
+	{
+		return bf_data_read_event;
+	}
+
+// bulk transfers ==============================================================
+	void read_n ( T* data, int count )
+	{
+		while ( count > 0 )
+		{
+			while ( num_available() == 0 )
+			{
+				sc_core::wait( bf_data_written_event );
+			}
+			int n	 = nb_read_n( data, count );
+			data	+= n;
+			count	-= n;
+		}
+	}
+
+	int nb_read_n ( T* data, int count )
+	{
+		int n		= count < num_available() ? count : num_available();
+		int first;
+
+		if ( n <= 0 )
+		{
+			return 0;
+		}
+		first		= std::min( n, bf_size - bf_ri );						// up to the end of the ring
+
+		std::copy( bf_buf + bf_ri, bf_buf + bf_ri + first, data );
+		std::copy( bf_buf, bf_buf + (n - first), data + first );
+		bf_ri = ( bf_ri + n ) % bf_size;
+		bf_num_read += n;
+		request_update_once();
+		return n;
+	}
+
+	void write_n ( const T* data, int count )
+	{
+		while ( count > 0 )
+		{
+			while ( num_free() == 0 )
+			{
+				sc_core::wait( bf_data_read_event );
+			}
+			int n	 = nb_write_n( data, count );
+			data	+= n;
+			count	-= n;
+		}
+	}
+
+	int nb_write_n ( const T* data, int count )
+	{
+		int n		= count < num_free() ? count : num_free();
+		int first;
+
+		if ( n <= 0 )
+		{
+			return 0;
+		}
+		first		= std::min( n, bf_size - bf_wi );						// up to the end of the ring
+
+		std::copy( data, data + first, bf_buf + bf_wi );
+		std::copy( data + first, data + n, bf_buf );
+		bf_wi = ( bf_wi + n ) % bf_size;
+		bf_num_written += n;
+		request_update_once();
+		return n;
+	}
+
+	virtual const char* kind ( void ) const
+	{
+		return "block_fifo";
+	}
+
+protected:
+
+//======================================================================
+/// @brief makes the values written in this delta cycle readable and 
+///		notifies the events once for all the transfers of the delta cycle
+//======================================================================
+	void update ( void )
+	{
+		if ( bf_num_read > 0 )
+		{
+			bf_data_read_event.notify( sc_core::SC_ZERO_TIME );
+		}
+		if ( bf_num_written > 0 )
+		{
+			bf_data_written_event.notify( sc_core::SC_ZERO_TIME );
+		}
+		bf_num_readable		= bf_num_readable - bf_num_read + bf_num_written;
+		bf_num_read			= 0;
+		bf_num_written		= 0;
+		bf_update_pending	= false;
+	}
+
+private:
+
+	void request_update_once ( void )
+	{
+		if ( !bf_update_pending )
+		{
+			bf_update_pending = true;
+			request_update();
+		}
+	}
+
+	block_fifo				( const block_fifo& );							// disabled
+	block_fifo& operator=	( const block_fifo& );							// disabled
+
+	int						bf_size;										///< capacity of the ring buffer
+	char					*bf_raw;										///< allocated storage
+	T						*bf_buf;										///< ring buffer aligned on a cache line
+	int						bf_ri;											///< read position (reader side only)
+	int						bf_wi;											///< write position (writer side only)
+	int						bf_num_readable;								///< values readable in this delta cycle
+	int						bf_num_read;									///< values read in this delta cycle
+	int						bf_num_written;									///< values written in this delta cycle
+	bool					bf_update_pending;								///< update already requested for this delta cycle
+	sc_core::sc_event		bf_data_read_event;
+	sc_core::sc_event		bf_data_written_event;
+};
+
+#endif /*__BLOCK_FIFO_H__*/
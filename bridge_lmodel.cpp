@@ -34,6 +34,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string>
+#include <algorithm>
 #include "constants.h"
 #include "reporting.h"
 #include "memory.h"
@@ -46,8 +47,6 @@ static const char				*filename1				= "bridge_lmodel.cpp_C1";				///filename for
 static const char				*filename2				= "bridge_lmodel.cpp_C2";				///filename for transaction reports of process C2
 static const char				*suffix					= "notifcount_output.m";
 
-notification::report_actions	lm_actions_status		;
-
 //======================================================================
 /// @fn initiator_lmodel
 //
@@ -55,13 +54,19 @@ notification::report_actions	lm_actions_status		;
 //
 /// @details
 ///		It declares the thread processes ( lmodel_sae_thread(), lmodel_see_thread() ) 
-///		of this component.<br>
+///		of this component or, with PM_METHOD, their method processes
+///		( lmodel_sae_method(), lmodel_see_method() ). With PM_EXECUTOR, it declares
+///		no process.<br>
 ///		It binds the initiator and targets sockets to the module. <br>
 ///		It sets the global quantum and re-calculates the local quantum of 
 ///		each process for temporal decoupling. <br>
-///		It instantiates the blocks of memory, which will be used for the sae data and 
-///		and the result data of LM, and fills them with zeros <br>
-///		Finally it instantiates the computation core of LM.
+///		It registers the templates of its read transactions on the sae and of its 
+///		write transactions on the see in the payload pool. The pooled data buffers 
+///		hold the sae data and the result data of LM. With batch_sets > 0, the read 
+///		transaction of C1 covers batch_sets datasets of the sae, i.e. a whole sae cycle. 
+///		With incremental, the read transactions carry a dirty extension. With a cycle_timeout, 
+///		C1 waits for the completion of each sae cycle instead of reading it at a fixed offset. <br>
+///		Finally it instantiates the computation core of LM with the limits of the sensor channels.
 //
 //======================================================================
 bridge_lmodel::bridge_lmodel
@@ -79,7 +84,13 @@ bridge_lmodel::bridge_lmodel
 							, sc_core::sc_time			sae_read_latency				///< read response delay on the sae memory for a single transaction
 							, unsigned int				cycle_trigger_nr_				///< number of interval between the execution of the monitor processes (in process cycles)
 							, sc_core::sc_time			glob_quantum					///< time value for the globl quantum
-							, unsigned int				nodenbr_						///< Position index for the vectoors of events
+							, node_sync&				sync							///< events of the node
+							, payload_pool&				pool							///< payload pool of the node
+							, process_mode				mode							///< implementation of C1 and C2
+							, unsigned int				batch_sets						///< number of sae datasets read by C1 in one transaction, 0 to read them one by one
+							, const char*				limits_file						///< limits file of the sensor channels, 0 without limit checking
+							, bool						incremental						///< evaluates only the sae datasets written since their last evaluation
+							, sc_core::sc_time			cycle_timeout					///< max wait of C1 for the completion of an sae cycle, SC_ZERO_TIME without barrier
 							)
 							: 
 							  lm_id					(	ID					)
@@ -94,6 +105,9 @@ bridge_lmodel::bridge_lmodel
 							, lm_sae_delay			(	sc_core::sc_time( 0.4, node_time_unit ) )
 							, lm_see_delay			(	sc_core::sc_time( 0.4, node_time_unit ) )
 							, m_cycle_nr_trigger	(	cycle_trigger_nr_	)
+							, lm_cycles_counter		(	1					)
+							, lm_sae_state			(	PS_START			)
+							, lm_see_state			(	PS_START			)
 							, lm_repmem													///< memory object for report data
 								(
 								  ID
@@ -102,16 +116,33 @@ bridge_lmodel::bridge_lmodel
 								, mem_size
 								, mem_width
 								)
-								, nodenbr(nodenbr_)
+							, lm_pool				(	pool				)
+							, lm_sync				(	sync				)
+							, lm_actions_status		(	notification::ACTION_FAILED	)
+							, lm_sae_sets			(	batch_sets			)
+							, lm_incremental		(	incremental			)
+							, lm_cycle_timeout		(	cycle_timeout		)
+							, lm_sae_barrier		(	false				)
 {
-	lm_sae_data = new unsigned char[size_t(lm_sae_dl)];
-	memset( lm_sae_data, 0, size_t(lm_sae_dl) );
-
-	lm_res_data = new unsigned char[size_t(lm_res_dl)];
-	memset( lm_res_data, 0, size_t(lm_res_dl) );
+	if ( lm_sae_sets > 0 )
+	{
+		lm_verdicts.resize( lm_sae_sets );
+		lm_sae_tmpl = lm_pool.add_template( tlm::TLM_READ_COMMAND	, lm_sae_dl * lm_sae_sets );
+	}
+	else
+		lm_sae_tmpl = lm_pool.add_template( tlm::TLM_READ_COMMAND	, lm_sae_dl );
+	lm_see_tmpl = lm_pool.add_template( tlm::TLM_WRITE_COMMAND	, lm_res_dl );
 
-	SC_THREAD(lmodel_sae_thread);
-	SC_THREAD(lmodel_see_thread);
+	if ( mode == PM_METHOD )
+	{
+		SC_METHOD(lmodel_sae_method);
+		SC_METHOD(lmodel_see_method);
+	}
+	else if ( mode == PM_THREAD )
+	{
+		SC_THREAD(lmodel_sae_thread);
+		SC_THREAD(lmodel_see_thread);
+	}
 
 	lm_qk1.set_global_quantum(glob_quantum);
 	lm_qk2.set_global_quantum(glob_quantum);
@@ -124,7 +155,7 @@ bridge_lmodel::bridge_lmodel
 	lm_m_tsocket.bind	( *this );
 
 	std::string parname = sc_core::sc_get_parent(this)->name();
-	lm_core_obj = new lm_core(parname);
+	lm_core_obj = new lm_core(parname, lm_sae_dl, lm_res_dl, limits_file);
 	lm_notifcount_file = file_ops::build_filename(lm_name, suffix);
 
 
@@ -137,59 +168,32 @@ bridge_lmodel::bridge_lmodel
 /// @brief Thread process C1 of the Node.
 //
 /// @details
-///		By each execution, it generates a read transaction on the SAE Memory, evaluates the data. The same transaction object is used
-///		for all transactions, but its attributes are set before each one of them. <br>
-///		By every execution, it also increments the variable #cycles_counter and compares the updated variable with m_cycle_nr_trigger. If both variables 
-///		have the same value, then  counter cycles_counter  is reset and the event lmodel_to_monitor_ev belonging to the dynamic sensitivity of process E1 is notified. 
-///		Otherwise event monitor_ev, which rahther belongs to the dynamic sensitiviy of process C2, is notified. Finally it suspends and is resumed in the next delta cycle.
-//
-/// @see	initiator_sensorenv::do_report()
-///	@see 	initiator_sensorenv::set_trans_Obj()
-/// @see 	initiator_sensorenv::execute_trans(tlm::tlm_generic_payload& tObj)
-///	@see	trtr::follow_transactions()
+///		It performs the transfer of C1 ( lmodel_sae_transfer() ) and is resumed in the next delta cycle.
+///		With the barrier, it first waits at the start of each sae cycle until the sae
+///		notifies its completion, at most #lm_cycle_timeout.
+//
+/// @see	bridge_lmodel::lmodel_sae_transfer()
+/// @see	target_sae::track_cycles()
+///	@see	trtr::follow_synch()
 //
 //======================================================================
 void bridge_lmodel::lmodel_sae_thread()						//C1
 {
-	unsigned int		burst_length	= ( (unsigned int)(ceil((double)lm_sae_dl/buswidth1)));
-	unsigned int		cycles_counter	= 1;
-
 	wait(lm_sae_delay);
 	while(true)
 	{
-		lm_sae_delay = lm_qk1.get_local_time();
-		set_target_id( sae_id_nr );
-
-		set_trans_Obj	( lm_sae_tObj, tlm::TLM_READ_COMMAND, lm_target_id, lm_sae_data, sae_adr_start );
-		execute_trans	( lm_sae_tObj, lm_target_id );
-		lm_core_obj->evaluate_data(lm_sae_data, lm_actions_status);
-		do_report();
-
-		sae_adr_start += lm_sae_dl;
-
-		if ( ( cycles_counter == m_cycle_nr_trigger) && (m_cycle_nr_trigger > 0) )
+		if ( sae_cycle_pending() )
 		{
-			lmodel_to_monitor_vector.at(nodenbr).notify();
-			cycles_counter = 0;
-
-		}
-		else
-		{
-			monitor_ev_vector.at(nodenbr).notify();
+			wait( lm_cycle_timeout, lm_sync.sae_cycle_ev );
 		}
-
-		lm_qk1.set( lm_sae_delay );							// Update quantum keeper with time consumed by target
+		lmodel_sae_transfer();
 		wait(sc_core::SC_ZERO_TIME); 
 
 		if ( lm_qk1.need_sync() )
 		{
-			cycles_counter++;
-
 			trtr::follow_synch(filename, lm_name, "C1",  lm_id, lm_sae_delay,trtr::S_NEED);
 			lm_qk1.sync();									// Check local time against quantum and sync if neccessary
 			trtr::follow_synch(filename, lm_name, "C1", lm_id, lm_sae_delay,trtr::S_RETURN);
-
-			sae_adr_start	=	0;
 		}
 		wait(SC_ZERO_TIME);
 	}
@@ -201,40 +205,22 @@ void bridge_lmodel::lmodel_sae_thread()						//C1
 /// @brief Thread process C2 of the Node.
 //
 /// @details
-///		By every execution, it sets the attributes of the transaction object and 
-///		generate write transactions on the see's memory space specially intended for him. <br> 
-///		It suspends after every performed transaction until its event #monitor_ev is notified.
+///		It performs the transfer of C2 ( lmodel_see_transfer() ) each time its 
+///		event #monitor_ev is notified.
 //
-///	@see 	initiator_sensorenv::set_trans_Obj()
-/// @see 	initiator_sensorenv::execute_trans()
-///	@see	trtr::follow_transactions()
+/// @see	bridge_lmodel::lmodel_see_transfer()
+///	@see	trtr::follow_synch()
 //
 //======================================================================
 void bridge_lmodel::lmodel_see_thread()		//C2
 {
 	sc_core::sc_time	wait_time			= sc_core::SC_ZERO_TIME;
-	unsigned int		burst_length		= ( (unsigned int)(ceil((double)lm_res_dl/buswidth5)));
-	lm_res_data		=	new unsigned char[size_t(lm_sae_dl)];
 
 	while ( true )
 	{
-		wait( monitor_ev_vector.at(nodenbr) );
-
-		lm_see_delay	=	lm_qk2.get_local_time();
-
-		set_target_id( see_id_nr );
-
-		if (lm_actions_status == 33)
-			lm_core_obj->send_data(lm_res_data);		//get difference result as char array
-		else
-			memset( lm_res_data, 0, size_t(lm_res_dl) );
-		
-		set_trans_Obj	( lm_see_tObj, tlm::TLM_WRITE_COMMAND, lm_target_id, lm_res_data, see_adr_start);
-		execute_trans	( lm_see_tObj, lm_target_id );
-
-		lmodel_to_see_vector.at(nodenbr).notify();
+		wait( lm_sync.monitor_ev );
 
-		lm_qk2.set( lm_see_delay );						// Update quantum keeper with time consumed by target
+		lmodel_see_transfer();
 		wait(wait_time);
 
 		if ( lm_qk2.need_sync() )
@@ -246,6 +232,353 @@ void bridge_lmodel::lmodel_see_thread()		//C2
 	}
 }
 
+//======================================================================
+/// @fn lmodel_sae_method
+//
+/// @brief Process C1 of the Node as SC_METHOD.
+//
+/// @details
+///		It behaves like lmodel_sae_thread(): each wait() of the thread is
+///		replaced by a next_trigger() and the state #lm_sae_state in which the 
+///		method is resumed. The synchronization of the quantum keeper is
+///		split into the trigger on its local time and the reset of the keeper.
+///		The wait for the completion of the sae cycle is a trigger of PS_TRANSFER,
+///		marked by #lm_sae_barrier so that the transfer follows it in any case.
+//
+/// @see	bridge_lmodel::lmodel_sae_thread()
+//
+//======================================================================
+void bridge_lmodel::lmodel_sae_method()						//C1
+{
+	switch ( lm_sae_state )
+	{
+		case PS_START:
+			lm_sae_state = PS_TRANSFER;
+			next_trigger( lm_sae_delay );
+			break;
+
+		case PS_TRANSFER:
+			if ( !lm_sae_barrier && sae_cycle_pending() )
+			{
+				lm_sae_barrier = true;
+				next_trigger( lm_cycle_timeout, lm_sync.sae_cycle_ev );
+				break;
+			}
+			lm_sae_barrier = false;
+			lmodel_sae_transfer();
+			lm_sae_state = PS_CHECK;
+			next_trigger( sc_core::SC_ZERO_TIME );
+			break;
+
+		case PS_CHECK:
+			if ( lm_qk1.need_sync() )
+			{
+				trtr::follow_synch(filename, lm_name, "C1",  lm_id, lm_sae_delay,trtr::S_NEED);
+				lm_sae_state = PS_SYNC;
+				next_trigger( lm_qk1.get_local_time() );		// Check local time against quantum and sync
+			}
+			else
+			{
+				lm_sae_state = PS_TRANSFER;
+				next_trigger( sc_core::SC_ZERO_TIME );
+			}
+			break;
+
+		case PS_SYNC:
+			lm_qk1.reset();
+			trtr::follow_synch(filename, lm_name, "C1", lm_id, lm_sae_delay,trtr::S_RETURN);
+
+			lm_sae_state	=	PS_TRANSFER;
+			next_trigger( sc_core::SC_ZERO_TIME );
+			break;
+	}
+}
+
+
+//======================================================================
+/// @fn lmodel_see_method
+//
+/// @brief Process C2 of the Node as SC_METHOD.
+//
+/// @details
+///		It behaves like lmodel_see_thread(), with the state #lm_see_state.
+//
+/// @see	bridge_lmodel::lmodel_see_thread()
+//
+//======================================================================
+void bridge_lmodel::lmodel_see_method()						//C2
+{
+	switch ( lm_see_state )
+	{
+		case PS_START:
+			lm_see_state = PS_TRANSFER;
+			next_trigger( lm_sync.monitor_ev );
+			break;
+
+		case PS_TRANSFER:
+			lmodel_see_transfer();
+			lm_see_state = PS_CHECK;
+			next_trigger( sc_core::SC_ZERO_TIME );
+			break;
+
+		case PS_CHECK:
+			if ( lm_qk2.need_sync() )
+			{
+				trtr::follow_synch(filename, lm_name, "C2", lm_id, lm_see_delay,trtr::S_NEED);
+				lm_see_state = PS_SYNC;
+				next_trigger( lm_qk2.get_local_time() );		// Check local time against quantum and sync
+			}
+			else
+			{
+				lm_see_state = PS_TRANSFER;
+				next_trigger( lm_sync.monitor_ev );
+			}
+			break;
+
+		case PS_SYNC:
+			lm_qk2.reset();
+			trtr::follow_synch(filename, lm_name, "C2", lm_id, lm_see_delay,trtr::S_RETURN);
+
+			lm_see_state = PS_TRANSFER;
+			next_trigger( lm_sync.monitor_ev );
+			break;
+	}
+}
+
+
+//======================================================================
+/// @fn lmodel_sae_transfer
+//
+/// @brief transfer of process C1, common to its thread and method implementations.
+//
+/// @details
+///		By each execution, it generates a read transaction on the SAE Memory, evaluates the data. Each transaction object is taken 
+///		from the payload pool of the node and the data is evaluated in its pooled data buffer before it is released. 
+///		In batch mode the transaction reads the datasets of a whole sae cycle, so that C1 performs one transfer per quantum. <br>
+///		By every execution, it also compares the variable #lm_cycles_counter with m_cycle_nr_trigger. If both variables 
+///		have the same value, then  counter lm_cycles_counter  is reset and the event lmodel_to_monitor_ev belonging to the dynamic sensitivity of process E1 is notified. 
+///		Otherwise event monitor_ev, which rahther belongs to the dynamic sensitiviy of process C2, is notified. Finally the quantum keeper is updated.
+///		After the last transfer of a quantum, the counter is incremented and the sae address is reset.
+///		Since a batch covers the whole sae, its transfer is always the last one of the quantum.
+///		The data of a failed read isn't evaluated. <br>
+///		With the barrier, the first transfer of an sae cycle consumes its completion ( start_sae_cycle() ).
+//
+/// @retval true if the monitor (E1) has been notified, false if C2 has been notified
+//
+/// @see	bridge_lmodel::do_report()
+///	@see 	bridge_lmodel::set_trans_Obj()
+/// @see 	bridge_lmodel::execute_trans()
+///	@see	trtr::follow_transactions()
+//
+//======================================================================
+bool bridge_lmodel::lmodel_sae_transfer()
+{
+	tlm::tlm_generic_payload	*tObj;
+	bool						monitor_triggered	= false;
+
+	lm_sae_delay = lm_qk1.get_local_time();
+	set_target_id( sae_id_nr );
+	if ( lm_cycle_timeout != sc_core::SC_ZERO_TIME && sae_adr_start == 0 )
+	{
+		start_sae_cycle();
+	}
+
+	tObj			= lm_pool.allocate( lm_sae_tmpl );
+	set_trans_Obj	( *tObj, sae_adr_start );
+	if ( lm_incremental )
+	{
+		lm_dirty.de_dirty.clear();
+		tObj->set_extension( &lm_dirty );
+	}
+	execute_trans	( *tObj, lm_target_id );
+	if ( lm_incremental )
+	{
+		tObj->clear_extension( &lm_dirty );
+	}
+	if ( tObj->is_response_ok() )						// a failed read keeps ACTION_FAILED
+	{
+		evaluate_sae_data( tObj->get_data_ptr(), (unsigned int)(sae_adr_start / lm_sae_dl) );
+	}
+	sae_adr_start += tObj->get_data_length();
+	tObj->release	();
+	do_report();
+	lm_sync.lm_report_version = lm_repmem.get_version();
+
+	if ( ( lm_cycles_counter == m_cycle_nr_trigger) && (m_cycle_nr_trigger > 0) )
+	{
+		lm_sync.lmodel_to_monitor.notify();
+		lm_cycles_counter = 0;
+		monitor_triggered = true;
+	}
+	else
+	{
+		lm_sync.monitor_ev.notify();
+	}
+
+	if ( lm_sae_sets > 0 )								// the batch has read the whole sae: no further read in this quantum
+	{
+		lm_sae_delay = std::max( lm_sae_delay, time_to_quantum_end() );
+	}
+	lm_qk1.set( lm_sae_delay );							// Update quantum keeper with time consumed by target
+	if ( lm_qk1.need_sync() )							// last process cycle of the quantum
+	{
+		lm_cycles_counter++;
+		sae_adr_start	=	0;
+	}
+	return monitor_triggered;
+}
+
+
+//======================================================================
+/// @fn time_to_quantum_end
+//
+/// @brief returns the time from the current simulation time to the end of its quantum
+//
+//======================================================================
+sc_core::sc_time bridge_lmodel::time_to_quantum_end()
+{
+	const sc_core::sc_time	&quantum	= lm_qk1.get_global_quantum();
+
+	if ( quantum == sc_core::SC_ZERO_TIME )
+	{
+		return sc_core::SC_ZERO_TIME;
+	}
+	return quantum - ( sc_core::sc_time_stamp() % quantum );
+}
+
+
+//======================================================================
+/// @fn start_sae_cycle
+//
+/// @brief consumes the completion of the sae cycle before its first read.
+//
+/// @details
+///		It clears node_sync::sae_cycle_complete. If the sae hasn't signaled the
+///		completion, C1 has waited for #lm_cycle_timeout and reads the cycle with
+///		the data of the missing initiators from the previous cycle. Their late 
+///		writes are counted for the next cycle.
+//
+/// @see	target_sae::track_cycles()
+//
+//======================================================================
+void bridge_lmodel::start_sae_cycle()
+{
+	std::ostringstream  msg;
+
+	if ( !lm_sync.sae_cycle_complete )
+	{
+		msg << "\t" << lm_name << ": sae cycle incomplete after " << lm_cycle_timeout;
+		WARNING_LOG(filename, __FUNCTION__ , msg.str());
+	}
+	lm_sync.sae_cycle_complete = false;
+}
+
+
+//======================================================================
+/// @fn evaluate_sae_data
+//
+/// @brief evaluates the sae data read by C1.
+//
+/// @details
+///		Without batch, the dataset is evaluated by lm_core::evaluate_data(). In batch mode, 
+///		all datasets are evaluated by lm_core::evaluate_batch() and #lm_actions_status
+///		is ACTION_NEEDED as soon as one of them needs actions. <br>
+///		In incremental mode, only the datasets flagged as dirty by the sae are evaluated.
+///		The others keep the verdict of their last evaluation: #lm_slot_verdicts holds it
+///		for each slot of the sae read one by one, #lm_verdicts for the datasets of a batch.
+///		The verdicts aren't reused if they depend on the previous data ( lm_core::reuses_verdicts() ),
+///		and never replace the ACTION_FAILED of a failed read.
+//
+/// @see	lm_core::evaluate_batch()
+//
+//======================================================================
+void bridge_lmodel::evaluate_sae_data(unsigned char* data, unsigned int slot)
+{
+	bool	reuse	= lm_incremental && lm_core_obj->reuses_verdicts();
+
+	if ( lm_actions_status == notification::ACTION_FAILED )
+	{
+		return;
+	}
+	if ( lm_sae_sets == 0 )
+	{
+		if ( lm_incremental && slot >= lm_slot_verdicts.size() )
+		{
+			lm_slot_verdicts.resize( slot + 1, notification::READ );
+		}
+		if ( reuse && !lm_dirty.is_dirty(0) )
+		{
+			lm_actions_status = lm_slot_verdicts[slot];
+			return;
+		}
+		lm_core_obj->evaluate_data(data, slot, lm_actions_status);
+		if ( lm_incremental )
+		{
+			lm_slot_verdicts[slot] = lm_actions_status;
+		}
+		return;
+	}
+
+	for (unsigned int i = 0; i < lm_sae_sets; i++)
+	{
+		if ( !reuse || lm_dirty.is_dirty(i) )
+		{
+			lm_verdicts[i] = lm_actions_status;
+		}
+	}
+	lm_core_obj->evaluate_batch(data, lm_sae_sets, lm_sae_dl, lm_verdicts, lm_dirty.de_dirty);
+
+	for (unsigned int i = 0; i < lm_sae_sets; i++)
+	{
+		if ( lm_verdicts[i] == notification::ACTION_NEEDED )
+		{
+			lm_actions_status = notification::ACTION_NEEDED;
+			break;
+		}
+	}
+}
+
+
+//======================================================================
+/// @fn lmodel_see_transfer
+//
+/// @brief transfer of process C2, common to its thread and method implementations.
+//
+/// @details
+///		By every execution, it takes a transaction object from the payload pool, writes the
+///		result data into its pooled data buffer and generate write transactions on the see's 
+///		memory space specially intended for him. Then it notifies the SEE and updates the
+///		quantum keeper.
+//
+///	@see 	bridge_lmodel::set_trans_Obj()
+/// @see 	bridge_lmodel::execute_trans()
+///	@see	trtr::follow_transactions()
+//
+//======================================================================
+void bridge_lmodel::lmodel_see_transfer()
+{
+	tlm::tlm_generic_payload	*tObj;
+
+	lm_see_delay	=	lm_qk2.get_local_time();
+
+	set_target_id( see_id_nr );
+
+	tObj	=	lm_pool.allocate( lm_see_tmpl );
+	if (lm_actions_status == 33)
+		lm_core_obj->send_data(tObj->get_data_ptr());		//get difference result as char array
+	else
+		memset( tObj->get_data_ptr(), 0, size_t(lm_res_dl) );
+	
+	set_trans_Obj	( *tObj, see_adr_start);
+	execute_trans	( *tObj, lm_target_id );
+	tObj->release	();
+
+	lm_sync.lmodel_to_see.notify();
+
+	lm_qk2.set( lm_see_delay );						// Update quantum keeper with time consumed by target
+}
+
+
 //======================================================================
 /// @fn execute_trans
 //
@@ -299,40 +632,19 @@ void bridge_lmodel::execute_trans(	tlm::tlm_generic_payload& tObj,
 //======================================================================
 /// @fn set_trans_Obj
 //
-/// @brief uses the given parameters to build a new transaction object for
-///		each transaction initiated by the LM component.
+/// @brief uses the given parameters to complete a transaction object of the
+///		pool for each transaction initiated by the LM component.
+//
+/// @details
+///		The command, data length and data buffer are set by the template
+///		of the target component.
 //
 //======================================================================
 void bridge_lmodel::set_trans_Obj(	tlm::tlm_generic_payload& tObj, 
-									tlm::tlm_command cmd, 
-									const unsigned int &target_id,
-									unsigned char* data,
 									sc_dt::uint64 adr)
 {
-	unsigned int	data_length;
-	
-	switch(target_id)
-	{
-		case(sae_id_nr):
-			tObj.set_command		(	tlm::TLM_READ_COMMAND	);
-			tObj.set_data_length	(	lm_sae_dl				);
-			tObj.set_streaming_width(	lm_sae_dl				);		
-			break;
-
-		case(see_id_nr):
-			tObj.set_command		(	tlm::TLM_WRITE_COMMAND	);
-			tObj.set_data_length	(	lm_res_dl				);
-			tObj.set_streaming_width(	lm_res_dl				);
-			break;
-	}
-		tObj.set_address			(	adr						);
-		tObj.set_data_ptr			(	data					);
-		tObj.set_response_status	(	tlm::TLM_INCOMPLETE_RESPONSE);
-		tObj.set_gp_option			(	tlm::TLM_MIN_PAYLOAD	); //??
-		tObj.set_dmi_allowed		(	false					);
-		tObj.set_byte_enable_ptr	(	0						);
-		tObj.set_byte_enable_length (	0						);
-	}
+	tObj.set_address			(	adr						);
+}
 
 
 //======================================================================
@@ -375,9 +687,16 @@ void bridge_lmodel::set_trans_Obj(	tlm::tlm_generic_payload& tObj,
 		return tlm::TLM_ACCEPTED;
 	}
 
+//======================================================================
+/// @fn transport_dbg
+//
+/// @brief Implementation of the debug transport for zero time accesses on 
+///		the LM report memory.
+//
+//======================================================================
 	unsigned int bridge_lmodel::transport_dbg	(	tlm::tlm_generic_payload& tObj )
 	{
-		return 0;
+		return lm_repmem.debug_operation(tObj);
 	}
 
 
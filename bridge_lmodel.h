@@ -40,7 +40,11 @@
 ///		Its Role: Brigde <br>
 ///		Its Targets: SAE and SEE <br>
 ///		Its Initiator: GVOC <br>
-///		Its Processes: C1 and C2
+///		Its Processes: C1 and C2 <br>
+///		The processes are either SC_THREADs or, chosen at elaboration, SC_METHODs
+///		with an explicit state, which spare the context switch of each activation.
+///		In the executor mode of the node, the transfers are called by the executor
+///		thread of the node.
 //
 //==============================================================================
 
@@ -54,6 +58,8 @@
 #include "memory.h"
 #include "constants.h"
 #include "lm_core.h"
+#include "payload_pool.h"
+#include "dirty_extension.h"
 
 
 class bridge_lmodel:	public sc_module, 
@@ -76,7 +82,13 @@ public:
 					, sc_core::sc_time			sae_read_latency				///< read response delay on the sae memory for a single transaction
 					, unsigned int				cycle_trigger_nr_				///< number of interval between the execution of the monitor processes (in process cycles)
 					, sc_core::sc_time			glob_quantum					///< time value for the globl quantum
-					, unsigned int				nodenbr_						///< Position index for the vectoors of events
+					, node_sync&				sync							///< events of the node
+					, payload_pool&				pool							///< payload pool of the node
+					, process_mode				mode							///< implementation of C1 and C2
+					, unsigned int				batch_sets						///< number of sae datasets read by C1 in one transaction, 0 to read them one by one
+					, const char*				limits_file						///< limits file of the sensor channels, 0 without limit checking
+					, bool						incremental						///< evaluates only the sae datasets written since their last evaluation
+					, sc_core::sc_time			cycle_timeout					///< max wait of C1 for the completion of an sae cycle, SC_ZERO_TIME without barrier
 					);
 	
 	SC_HAS_PROCESS(bridge_lmodel);
@@ -88,10 +100,21 @@ public:
 
 	void lmodel_see_thread(void);
 
+	void lmodel_sae_method(void);
+
+	void lmodel_see_method(void);
+
+	bool lmodel_sae_transfer(void);
+
+	void lmodel_see_transfer(void);
+
+	/// quantum keeper of C1
+	tlm_utils::tlm_quantumkeeper& get_sae_qk(void)		{ return lm_qk1; }
+
+	/// quantum keeper of C2
+	tlm_utils::tlm_quantumkeeper& get_see_qk(void)		{ return lm_qk2; }
+
 	void set_trans_Obj	( 	tlm::tlm_generic_payload&, 							///< ref to transaction object
-							tlm::tlm_command cmd, 								///< transaction command (read or write)
-							const unsigned int &target_id,						///< const ref to target component ID
-							unsigned char* data,								///< transaction data
 							sc_dt::uint64 adr									///< transaction start address
 						);
 
@@ -99,6 +122,15 @@ public:
 							const unsigned int &target_id						///< const ref to target component ID
 						);
 
+	void evaluate_sae_data(unsigned char* data, unsigned int slot);
+
+	/// true if C1 has to wait for the completion of the sae cycle before reading it
+	bool sae_cycle_pending(void)	{ return lm_cycle_timeout != sc_core::SC_ZERO_TIME && sae_adr_start == 0 && !lm_sync.sae_cycle_complete; }
+
+	void start_sae_cycle(void);
+
+	sc_core::sc_time time_to_quantum_end(void);
+
 	void do_report(void);
 	  
 // interface Methods - forward path
@@ -141,19 +173,28 @@ private:
 	memory							lm_repmem;
 	unsigned int					lm_id;										///< component id
 	std::string 					lm_name;									///< module name
-	tlm::tlm_generic_payload		lm_sae_tObj, lm_see_tObj;					///< transaction objects
+	payload_pool&					lm_pool;									///< payload pool of the node
+	node_sync&						lm_sync;									///< events of the node
+	notification::report_actions	lm_actions_status;							///< evaluation result of the last sensor data
+	unsigned int					lm_sae_sets;								///< datasets per read transaction on the sae, 0 without batch
+	std::vector<notification::report_actions>	lm_verdicts;					///< evaluation results of the datasets of a batch
+	bool							lm_incremental;								///< evaluation of the dirty sae datasets only
+	dirty_extension					lm_dirty;									///< dirty flags of the datasets read from the sae
+	std::vector<notification::report_actions>	lm_slot_verdicts;				///< evaluation results of the sae datasets read one by one
+	sc_core::sc_time				lm_cycle_timeout;							///< max wait for the completion of an sae cycle, SC_ZERO_TIME without barrier
+	bool							lm_sae_barrier;								///< C1 as SC_METHOD returns from the wait for the completion of the sae cycle
+	unsigned int					lm_sae_tmpl, lm_see_tmpl;					///< template indexes of the read and write transactions in the pool
 	unsigned int					lm_sae_dl, lm_res_dl, lm_rep_dl;			///< data lengths						
 	sc_core::sc_time				lm_sae_delay, lm_see_delay;					///< time delay temporal decoupling							
 	sc_dt::uint64					sae_adr_start, see_adr_start;				///< transaction start adresses
 	unsigned int					lm_target_id;								///< transaction target
 	tlm_utils::tlm_quantumkeeper	lm_qk1, lm_qk2;								///< quantum keepers
-	sc_dt::uchar					*lm_res_data, *lm_sae_data;					///< pointers
 	unsigned int					m_cycle_nr_trigger;							///< user specification with which the monitor component
+	unsigned int					lm_cycles_counter;							///< process cycles of C1 since the last trigger of the monitor
+	process_state					lm_sae_state, lm_see_state;					///< states of C1 and C2 as SC_METHODs
 
 	void set_target_id				( const unsigned int &id ); 				///   defines the target component of the transaction by setting #lm_target_id.
 	lm_core							*lm_core_obj;								
-
-	unsigned int					nodenbr;
 	std::string						lm_notifcount_file;
 };
 
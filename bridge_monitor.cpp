@@ -51,10 +51,13 @@ static const char	*suffix			= "notifcount_output.m";
 //	    
 ///	@details
 ///		It declares the thread processes ( monitor_see_thread(), monitor_lm_thread() ) 
-///		of the componenent.<br>
+///		of the componenent or, with PM_METHOD, its method processes
+///		( monitor_see_method(), monitor_lm_method() ). With PM_EXECUTOR, it 
+///		declares no process.<br>
 ///		It binds the initiator and target sockets to the module.<br>
 ///		It sets the global quantum and initializes the local quantum of each 
-///		process for temporal decoupling.
+///		process for temporal decoupling.<br>
+///		It registers the templates of its read transactions in the payload pool.
 // 
 //=============================================================================
 bridge_monitor::bridge_monitor							///< constructor
@@ -69,7 +72,10 @@ bridge_monitor::bridge_monitor							///< constructor
 , const sc_core::sc_time	lm_read_latency_			///< write response delay 
 , const sc_core::sc_time	see_read_latency_			///< write response delay 
 , const sc_core::sc_time	glob_quantum				///< global time quantum
-, unsigned int				nodenbr_					///< Position index for the vectoors of events
+, node_sync&				sync						///< events of the node
+, payload_pool&				pool						///< payload pool of the node
+, process_mode				mode						///< implementation of E1 and E2
+, const sc_core::sc_time		max_staleness				///< maximum age of the read report data, SC_ZERO_TIME to read them at every trigger
 )		
 :	
   m_id						( ID					)
@@ -78,6 +84,8 @@ bridge_monitor::bridge_monitor							///< constructor
 , m_tsocket					( "tsocket"				)
 , m_see_delay				( sc_core::SC_ZERO_TIME	)
 , m_lm_delay				( sc_core::SC_ZERO_TIME	)
+, m_see_state				( PS_START				)
+, m_lm_state				( PS_START				)
 , m_see_report_dl			( see_report_data_length)
 , m_lm_report_dl			( lm_report_data_length	)
 , m_mem
@@ -88,10 +96,22 @@ bridge_monitor::bridge_monitor							///< constructor
 	, mem_size
 	, mem_width
 	)
-	, nodenbr(nodenbr_)
+, m_pool					( pool					)
+, m_sync					( sync					)
+, m_max_stale				( max_staleness			)
+, m_see_version				( ~0u					)
+, m_lm_version				( ~0u					)
 {
-	SC_THREAD(monitor_see_thread);				
-	SC_THREAD(monitor_lm_thread);				
+	if ( mode == PM_METHOD )
+	{
+		SC_METHOD(monitor_see_method);
+		SC_METHOD(monitor_lm_method);
+	}
+	else if ( mode == PM_THREAD )
+	{
+		SC_THREAD(monitor_see_thread);				
+		SC_THREAD(monitor_lm_thread);				
+	}
 
 	m_qk1.set_global_quantum(glob_quantum);
 	m_qk2.set_global_quantum(glob_quantum);
@@ -101,6 +121,9 @@ bridge_monitor::bridge_monitor							///< constructor
 
 	m_isocket.bind( *this );
 	m_tsocket.bind( *this );
+
+	m_lm_tmpl	= m_pool.add_template( tlm::TLM_READ_COMMAND, m_lm_report_dl	);
+	m_see_tmpl	= m_pool.add_template( tlm::TLM_READ_COMMAND, m_see_report_dl	);
 	
 	m_notifcount_file = file_ops::build_filename(m_name, suffix);
 
@@ -113,39 +136,26 @@ bridge_monitor::bridge_monitor							///< constructor
 ///	@brief Thread process E2 of the process cycle of the Node.
 //	    
 ///	@details
-///		It sets new transactions objects to read the report data from the SEE  
-///		memory. It suspends after every performed transaction and wait until
-///		it receives the SEE notification.
-///		<br> The funtion trtr::follow_transactions() is called before and 
+///		It performs the transfer of E2 ( monitor_see_transfer() ). It suspends 
+///		after every performed transaction and wait until it receives the SEE 
+///		notification.
+///		<br> The funtion trtr::follow_synch() is called before and 
 ///		after every process synchronization to report or monitor them.
 //
-///	@see 	bridge_monitor::set_trans_Obj()
-/// @see 	bridge_monitor::execute_trans()
-///	@see	trtr::follow_transactions()
+///	@see 	bridge_monitor::monitor_see_transfer()
+///	@see	trtr::follow_synch()
 //
 ///	@retval none    
 //=============================================================================
 void bridge_monitor::monitor_see_thread(void)			// zu bearbeiten //E2
 {
-	std::ostringstream	msg;							// log message
-	msg.str ("");
-
 	sc_core::sc_time	wait_time		= sc_core::SC_ZERO_TIME;
-	int					from_see_adr	= 0; 
-	unsigned char		*data			= new unsigned char[size_t(m_see_report_dl)];			///< The size of the array in which the data is copied is set to the value of the constant variable #dl_report_data.
-	unsigned int		burst_length	= (unsigned int)ceil((double)m_see_report_dl/buswidth2);
 
 	while ( true )
 	{
-		m_see_delay = m_qk1.get_local_time();
-		wait( see_to_monitor_vector.at(nodenbr) );
+		wait( m_sync.see_to_monitor );
 
-		set_target_id	( see_id_nr );
-		set_trans_Obj	( m_tObj, from_see_adr, data);
-		trtr::follow_transactions(filename2, m_name, m_id, m_see_delay, trtr::T_CALL, trtr::T_IGNORE, lmodel_id_nr);
-		execute_trans	( m_tObj	);
-
-		m_qk1.set( m_see_delay );						// Update quantum keeper with time consumed by target	
+		monitor_see_transfer();
 		wait(wait_time);	
 
 		if ( m_qk1.need_sync() )						// Check local time against quantum and sync if neccessary
@@ -154,7 +164,6 @@ void bridge_monitor::monitor_see_thread(void)			// zu bearbeiten //E2
 			m_qk1.sync();
 			trtr::follow_synch(filename, m_name, "E2", m_id, m_see_delay, trtr::S_RETURN);
 		}
-		memset( data, 0, size_t(m_see_report_dl) );
 	}
 
 }
@@ -167,38 +176,22 @@ void bridge_monitor::monitor_see_thread(void)			// zu bearbeiten //E2
 ///
 //  
 ///	@details
-///		It sets new transactions objects to read the report data from the LM  
-///		memory. It suspends after every performed transaction and wait until
-///		it receives the LM notification.
-///		<br> The funtion trtr::follow_transactions() is called before and 
+///		It performs the transfer of E1 ( monitor_lm_transfer() ). It suspends 
+///		after every performed transaction and wait until it receives the LM 
+///		notification.
+///		<br> The funtion trtr::follow_synch() is called before and 
 ///		after every process synchronization to report or monitor them.
 //
-///	@see 	bridge_monitor::set_trans_Obj()
-/// @see 	bridge_monitor::execute_trans()
-///	@see	trtr::follow_transactions() 
+///	@see 	bridge_monitor::monitor_lm_transfer()
+///	@see	trtr::follow_synch() 
 //=============================================================================
 void bridge_monitor::monitor_lm_thread(void) //E1
 {
-	std::ostringstream	msg;							// log message
-	msg.str ("");
-
-	unsigned char		*data			= new unsigned char[size_t(m_lm_report_dl)];	
-	unsigned int		burst_length	= (unsigned int)ceil((double)m_lm_report_dl/buswidth2);
-	unsigned int		from_lm_adr		= 0;
-	
 	while( true )
 	{
-		wait(lmodel_to_monitor_vector.at(nodenbr)); 
+		wait(m_sync.lmodel_to_monitor); 
 
-		m_lm_delay = m_qk2.get_local_time();
-		set_target_id	( lmodel_id_nr );
-		set_trans_Obj	( m_tObj, from_lm_adr, data );
-		trtr::follow_transactions(filename1, m_name, m_id, m_lm_delay, trtr::T_CALL, trtr::T_IGNORE, lmodel_id_nr);
-		execute_trans	(m_tObj);
-
-		monitor_ev_vector.at(nodenbr).notify();
-
-		m_qk2.set( m_lm_delay );					// Update quantum keeper with time consumed by target
+		monitor_lm_transfer();
 		wait(sc_core::SC_ZERO_TIME);
 
 		if ( m_qk2.need_sync() ) 					// Check local time against quantum and sync if neccessary
@@ -207,37 +200,237 @@ void bridge_monitor::monitor_lm_thread(void) //E1
 			m_qk2.sync();
 			trtr::follow_synch(filename, m_name, "E1", m_id, m_lm_delay, trtr::S_RETURN);
 		}
-
-		memset( data, 0, size_t(m_lm_report_dl) );
 	}	
 }
 
 
+//=============================================================================
+///	@fn bridge_monitor::monitor_see_method
+//	    
+///	@brief Process E2 of the process cycle of the Node as SC_METHOD.
+//  
+///	@details
+///		It behaves like monitor_see_thread(): each wait() of the thread is
+///		replaced by a next_trigger() and the state #m_see_state in which the
+///		method is resumed.
+//
+///	@see 	bridge_monitor::monitor_see_thread()
+//=============================================================================
+void bridge_monitor::monitor_see_method(void) //E2
+{
+	switch ( m_see_state )
+	{
+	case PS_START:
+		m_see_state = PS_TRANSFER;
+		next_trigger( m_sync.see_to_monitor );
+		break;
+
+	case PS_TRANSFER:
+		monitor_see_transfer();
+		m_see_state = PS_CHECK;
+		next_trigger( sc_core::SC_ZERO_TIME );
+		break;
+
+	case PS_CHECK:
+		if ( m_qk1.need_sync() )						// Check local time against quantum and sync if neccessary
+		{
+			trtr::follow_synch(filename, m_name, "E2", m_id, m_see_delay, trtr::S_NEED);
+			m_see_state = PS_SYNC;
+			next_trigger( m_qk1.get_local_time() );
+		}
+		else
+		{
+			m_see_state = PS_TRANSFER;
+			next_trigger( m_sync.see_to_monitor );
+		}
+		break;
+
+	case PS_SYNC:
+		m_qk1.reset();
+		trtr::follow_synch(filename, m_name, "E2", m_id, m_see_delay, trtr::S_RETURN);
+		m_see_state = PS_TRANSFER;
+		next_trigger( m_sync.see_to_monitor );
+		break;
+	}
+}
+
+
+//=============================================================================
+///	@fn bridge_monitor::monitor_lm_method
+//	    
+///	@brief Process E1 of the process cycle of the Node as SC_METHOD.
+//  
+///	@details
+///		It behaves like monitor_lm_thread(), with the state #m_lm_state.
+//
+///	@see 	bridge_monitor::monitor_lm_thread()
+//=============================================================================
+void bridge_monitor::monitor_lm_method(void) //E1
+{
+	switch ( m_lm_state )
+	{
+	case PS_START:
+		m_lm_state = PS_TRANSFER;
+		next_trigger( m_sync.lmodel_to_monitor );
+		break;
+
+	case PS_TRANSFER:
+		monitor_lm_transfer();
+		m_lm_state = PS_CHECK;
+		next_trigger( sc_core::SC_ZERO_TIME );
+		break;
+
+	case PS_CHECK:
+		if ( m_qk2.need_sync() ) 					// Check local time against quantum and sync if neccessary
+		{
+			trtr::follow_synch(filename, m_name, "E1", m_id, m_lm_delay, trtr::S_NEED);
+			m_lm_state = PS_SYNC;
+			next_trigger( m_qk2.get_local_time() );
+		}
+		else
+		{
+			m_lm_state = PS_TRANSFER;
+			next_trigger( m_sync.lmodel_to_monitor );
+		}
+		break;
+
+	case PS_SYNC:
+		m_qk2.reset();
+		trtr::follow_synch(filename, m_name, "E1", m_id, m_lm_delay, trtr::S_RETURN);
+		m_lm_state = PS_TRANSFER;
+		next_trigger( m_sync.lmodel_to_monitor );
+		break;
+	}
+}
+
+
+//=============================================================================
+///	@fn bridge_monitor::monitor_see_transfer
+//	    
+///	@brief transfer of process E2, common to its thread and method implementations.
+//  
+///	@details
+///		It sets a new transaction object to read the report data from the SEE  
+///		memory and updates the quantum keeper. In adaptive mode, the read is 
+///		skipped if the report data hasn't changed and isn't too old yet.
+//
+///	@see 	bridge_monitor::set_trans_Obj()
+/// @see 	bridge_monitor::execute_trans()
+///	@see	trtr::follow_transactions()
+//=============================================================================
+void bridge_monitor::monitor_see_transfer(void)
+{
+	int					from_see_adr	= 0; 
+	tlm::tlm_generic_payload	*tObj;
+
+	m_see_delay = m_qk1.get_local_time();
+	if ( report_due( m_sync.see_report_version, m_see_version, m_see_read_time, m_qk1.get_current_time() ) )
+	{
+		set_target_id	( see_id_nr );
+		tObj			= m_pool.allocate( m_see_tmpl );
+		set_trans_Obj	( *tObj, from_see_adr);
+		trtr::follow_transactions(filename2, m_name, m_id, m_see_delay, trtr::T_CALL, trtr::T_IGNORE, lmodel_id_nr);
+		execute_trans	( *tObj	);
+		tObj->release	();
+	}
+
+	m_qk1.set( m_see_delay );						// Update quantum keeper with time consumed by target	
+}
+
+
+//=============================================================================
+///	@fn bridge_monitor::monitor_lm_transfer
+//	    
+///	@brief transfer of process E1, common to its thread and method implementations.
+//  
+///	@details
+///		It sets a new transaction object to read the report data from the LM  
+///		memory, notifies the process C2 and updates the quantum keeper. In 
+///		adaptive mode, the read is skipped if the report data hasn't changed 
+///		and isn't too old yet; C2 is notified anyway.
+//
+///	@see 	bridge_monitor::set_trans_Obj()
+/// @see 	bridge_monitor::execute_trans()
+///	@see	trtr::follow_transactions()
+//=============================================================================
+void bridge_monitor::monitor_lm_transfer(void)
+{
+	unsigned int		from_lm_adr		= 0;
+	tlm::tlm_generic_payload	*tObj;
+
+	m_lm_delay = m_qk2.get_local_time();
+	if ( report_due( m_sync.lm_report_version, m_lm_version, m_lm_read_time, m_qk2.get_current_time() ) )
+	{
+		set_target_id	( lmodel_id_nr );
+		tObj			= m_pool.allocate( m_lm_tmpl );
+		set_trans_Obj	( *tObj, from_lm_adr );
+		trtr::follow_transactions(filename1, m_name, m_id, m_lm_delay, trtr::T_CALL, trtr::T_IGNORE, lmodel_id_nr);
+		execute_trans	(*tObj);
+		tObj->release	();
+	}
+
+	m_sync.monitor_ev.notify();
+
+	m_qk2.set( m_lm_delay );					// Update quantum keeper with time consumed by target
+}
+
+
+//=============================================================================
+///	@fn bridge_monitor::report_due
+//	    
+///	@brief decides whether a report memory has to be read.
+//  
+///	@details
+///		Without adaptive sampling, the report memory is read at every trigger.
+///		Otherwise it is read only if the version published by its owner has 
+///		changed since the last read or if the last read is #m_max_stale old.
+//
+///	@retval true if the report memory has to be read
+//=============================================================================
+bool bridge_monitor::report_due	(	unsigned int version,
+									unsigned int &read_version,
+									sc_core::sc_time &read_time,
+									const sc_core::sc_time &now		)
+{
+	if ( m_max_stale == sc_core::SC_ZERO_TIME )
+	{
+		return true;
+	}
+	if ( version == read_version && ( now - read_time ) < m_max_stale )
+	{
+		return false;
+	}
+	read_version	= version;
+	read_time		= now;
+	return true;
+}
+
+
 void bridge_monitor::execute_trans( tlm::tlm_generic_payload& tObj)
 {
 	switch(m_target_idx)
 	{
 	case 0:	
-		m_isocket -> b_transport(m_tObj, m_lm_delay);
-		if ( m_tObj.is_response_ok() )				//in case of a successful transaction 
+		m_isocket -> b_transport(tObj, m_lm_delay);
+		if ( tObj.is_response_ok() )				//in case of a successful transaction 
 		{
 			trtr::follow_transactions(filename1, m_name, m_id, m_lm_delay, trtr::T_RETURN, trtr::T_SUCCESS, lmodel_id_nr);
 		}
 		else										//could not read
 		{
-			trtr::follow_transactions(filename1, m_name, m_id, m_lm_delay, trtr::T_RETURN, trtr::T_FAILURE, lmodel_id_nr , m_tObj.get_response_string().c_str() );
+			trtr::follow_transactions(filename1, m_name, m_id, m_lm_delay, trtr::T_RETURN, trtr::T_FAILURE, lmodel_id_nr , tObj.get_response_string().c_str() );
 		}
 		break;
 		
 	case 1:
-		m_isocket -> b_transport(m_tObj, m_see_delay);
-		if ( m_tObj.is_response_ok() )				//in case of a successful transaction 
+		m_isocket -> b_transport(tObj, m_see_delay);
+		if ( tObj.is_response_ok() )				//in case of a successful transaction 
 		{
 			trtr::follow_transactions(filename2, m_name, m_id, m_see_delay, trtr::T_RETURN, trtr::T_SUCCESS, see_id_nr);
 		}
 		else 										//could not read
 		{
-			trtr::follow_transactions(filename2, m_name, m_id, m_see_delay, trtr::T_RETURN, trtr::T_FAILURE, see_id_nr , m_tObj.get_response_string().c_str() );
+			trtr::follow_transactions(filename2, m_name, m_id, m_see_delay, trtr::T_RETURN, trtr::T_FAILURE, see_id_nr , tObj.get_response_string().c_str() );
 		}
 		break;
 
@@ -284,9 +477,16 @@ tlm::tlm_sync_enum bridge_monitor::nb_transport_fw	(	tlm::tlm_generic_payload& t
 }
 
 
+//=============================================================================
+///	@fn bridge_monitor::transport_dbg
+//	    
+///	@brief Implementation of the debug transport method for zero time accesses
+///		on the monitor memory.
+//
+//=============================================================================
 unsigned int bridge_monitor::transport_dbg	( tlm::tlm_generic_payload& tObj )
 {
-	return 0;
+	return m_mem.debug_operation(tObj);
 }
 	
 
@@ -318,44 +518,19 @@ tlm::tlm_sync_enum bridge_monitor::nb_transport_bw	(	tlm::tlm_generic_payload& t
 //=============================================================================
 ///	@fn bridge_monitor::set_trans_Obj
 //	    
-///	@brief uses the given parameters to build a new transaction object for
-///		each transaction initiated by the monitor component.
+///	@brief uses the given parameters to complete a transaction object of the
+///		pool for each transaction initiated by the monitor component.
+//
+///	@details
+///		The data length is set by the template of the target component. 
+///		The read data is stored in the pooled data buffer.
 //  
 //=============================================================================
 void bridge_monitor::set_trans_Obj	(	tlm::tlm_generic_payload& tObj,
-										const sc_dt::uint64 &adr,
-										unsigned char* data
+										const sc_dt::uint64 &adr
 									)
 {
-	std::ostringstream			msg;
-	unsigned int				data_length;
-
-	switch(m_target_idx)
-	{
-	case 0: //lmodel
-		data_length = m_lm_report_dl;
-		break;
-	case 1: //see
-		data_length = m_see_report_dl;
-		break;
-	default:
-		msg << "\t MONITOR: " << m_id
-			<< "\t Invalid Target ID: "<< m_target_idx;
-		ERROR_LOG(filename, __FUNCTION__ , msg.str());
-		break;
-	}
-
-	tObj.set_command			( tlm::TLM_READ_COMMAND		)	;
 	tObj.set_address			( adr 						)	;
-	tObj.set_data_ptr			( data 						)	;
-	tObj.set_data_length		( data_length				)	;
-	tObj.set_byte_enable_ptr	( 0 						)	;
-	tObj.set_byte_enable_length ( 0 						)	;
-	tObj.set_streaming_width	( data_length 				)	;
-	tObj.set_gp_option			( tlm::TLM_MIN_PAYLOAD		 )	;
-	tObj.set_dmi_allowed		( false 					)	;
-	tObj.set_response_status	( tlm::TLM_INCOMPLETE_RESPONSE );
-	
 }
 
 
@@ -39,7 +39,8 @@
 ///		Its role: Bridge <br>
 ///	 	Its initiator: GVOC through the Interconnect3 component. <br>
 ///	 	Its Targets: SEE and SAE through the Interconnect2 compponent <br>
-///		Its processes: E1 and E2
+///		Its processes: E1 and E2, as SC_THREADs or, chosen at elaboration, as SC_METHODs
+///		or run by the executor thread of the node
 //
 //==============================================================================
 
@@ -54,6 +55,7 @@
 
 #include "constants.h"
 #include "memory.h"
+#include "payload_pool.h"
 
 class bridge_monitor:	public sc_module,
 						virtual public tlm::tlm_fw_transport_if<>,
@@ -74,7 +76,10 @@ public:
 	  , const sc_core::sc_time		lm_read_latency_			///< write response delay on the LM memory for a single transaction
 	  , const sc_core::sc_time		see_read_latency_			///< write response delay on the see memory for a single transaction
 	  , const sc_core::sc_time		glob_quantum				///< time value for the globl quantum
-	  , unsigned int				nodenbr_					///< Position index for the vectoors of events
+	  , node_sync&					sync						///< events of the node
+	  , payload_pool&				pool						///< payload pool of the node
+	  , process_mode				mode						///< implementation of E1 and E2
+	  , const sc_core::sc_time		max_staleness				///< maximum age of the read report data, SC_ZERO_TIME to read them at every trigger
 	  );
 
 	SC_HAS_PROCESS ( bridge_monitor );
@@ -83,13 +88,28 @@ public:
 	
 	void monitor_see_thread(); //thread
 	void monitor_lm_thread();  //thread
+	void monitor_see_method(); //method
+	void monitor_lm_method();  //method
+
+	void monitor_see_transfer();
+	void monitor_lm_transfer();
+
+	bool report_due		(	unsigned int version,								///< version of the report memory published by its owner
+							unsigned int &read_version,							///< version at the last read
+							sc_core::sc_time &read_time,						///< time of the last read
+							const sc_core::sc_time &now							///< current time of the process
+						);
+
+	/// quantum keeper of E2
+	tlm_utils::tlm_quantumkeeper& get_see_qk()	{ return m_qk1; }
+	/// quantum keeper of E1
+	tlm_utils::tlm_quantumkeeper& get_lm_qk()	{ return m_qk2; }
 
 	void execute_trans	(	tlm::tlm_generic_payload& tObj 						///< ref to transaction object
 						);
 
 	void set_trans_Obj	(	tlm::tlm_generic_payload& tObj,						///< ref to transaction object
-							const sc_dt::uint64 &adr,							///< transaction start address
-							unsigned char* data									///< transaction data pointer
+							const sc_dt::uint64 &adr							///< transaction start address
 						);
 
 
@@ -108,7 +128,6 @@ public:
 											sc_core::sc_time& delay 			///< ref to delay time
 										);
 
-	/// Required and unused virtual method								
 	unsigned int transport_dbg 	( tlm::tlm_generic_payload& tObj 				///< ref to transaction object
 								);
 	
@@ -133,11 +152,16 @@ private:
 	const unsigned int				m_id;										///< monitor id
 	std::string						m_name;										///< module name
 	unsigned int					m_see_report_dl, m_lm_report_dl;			///< data lengths
-	tlm::tlm_generic_payload		m_tObj;										///< transaction object
+	payload_pool&					m_pool;										///< payload pool of the node
+	node_sync&						m_sync;										///< events of the node
+	unsigned int					m_see_tmpl, m_lm_tmpl;						///< template indexes of the read transactions in the pool
 	tlm_utils::tlm_quantumkeeper	m_qk1, m_qk2;								///< quantum keepers
 	sc_core::sc_time				m_see_delay, m_lm_delay;
+	process_state					m_see_state, m_lm_state;					///< states of E2 and E1 as SC_METHODs
 	memory							m_mem;										///< memory object
-	unsigned int					nodenbr;
+	sc_core::sc_time				m_max_stale;								///< maximum age of the read report data, adaptive sampling if not zero
+	unsigned int					m_see_version, m_lm_version;				///< versions of the report memories at the last read
+	sc_core::sc_time				m_see_read_time, m_lm_read_time;			///< times of the last reads
 
 	std::string	m_notifcount_file;
 };
@@ -34,7 +34,6 @@
 #include "reporting.h"
 
 unsigned int				see_target_idx			=	0							;
-unsigned int				see_actions_status		= notification::ACTION_FAILED	;
 static const char			*filename				= "bridge_see.cpp_D"			;			///< filename for reporting
 static const char			*suffix					= "notifcount_output.m"			;
 
@@ -47,9 +46,15 @@ static const char			*suffix					= "notifcount_output.m"			;
 /// @brief constructor
 //
 /// @details
-///		It declares the thread process ( see_thread() ) of this component.<br>
+///		It declares the thread process ( see_thread() ) of this component or,
+///		with PM_METHOD, its method process ( see_method() ). With PM_EXECUTOR,
+///		it declares no process.<br>
 ///		It sets the global quantum and re-calculates the local quantum of 
 ///		each process for temporal decoupling. It instantiates the memory objects
+///		and registers the template of its write transactions in the payload pool.
+///		With MC_BROADCAST, the write transactions carry a multicast extension which
+///		addresses all targets of IC4; with MC_SCATTER, the decision data holds one 
+///		slice of actions_data_length bytes per target.
 //
 //======================================================================
 bridge_see::bridge_see
@@ -68,7 +73,12 @@ bridge_see::bridge_see
 						, sc_core::sc_time			lm_write_latency					///< write response delay for a single transaction on the LM memory
 						, unsigned int				cycle_trigger_nr_					///< number of interval between the execution of the monitor processes (in process cycles)
 						, sc_core::sc_time			glob_quantum						///< time value for the globl quantum
-						, unsigned int				nodenbr_							///< Position index for the vectoors of events
+						, node_sync&				sync								///< events of the node
+						, payload_pool&				pool								///< payload pool of the node
+						, process_mode				mode								///< implementation of D
+						, const char*				rule_file							///< rule file of the decision table, 0 without decision table
+						, multicast_mode			multicast							///< delivery of the decisions to the targets of IC4
+						, unsigned int				target_number						///< number of targets of IC4
 						):
 						  see_name					( name()			)
 						, see_id					( ID				)
@@ -79,8 +89,12 @@ bridge_see::bridge_see
 						, see_rep_mem_size			( report_memory_size)
 						, see_rep_data_length		( report_data_length)
 						, see_act_data_length		( actions_data_length)
+						, see_dec_length			( multicast == MC_SCATTER ? actions_data_length * target_number : actions_data_length )
+						, see_multicast				( multicast != MC_NONE && target_number > 0 )
 						, see_idelay				( sc_core::sc_time( 0, node_time_unit)	)
 						, m_cycle_nr_trigger		( cycle_trigger_nr_						)
+						, see_cycles_counter		( 1										)
+						, see_state					( PS_START								)
 						, see_lm_mem
 							( ID					// initiator ID for messaging
 							, read_latency			// delay for reads
@@ -102,9 +116,18 @@ bridge_see::bridge_see
 							, report_memory_size	// memory size (bytes)
 							, rep_memory_width		// memory width (bytes) 
 							)
-							, nodenbr(nodenbr_)
+						, see_pool					( pool				)
+						, see_sync					( sync				)
+						, see_actions_status		( notification::ACTION_FAILED )
 {
-	SC_THREAD(see_thread);
+	if ( mode == PM_METHOD )
+	{
+		SC_METHOD(see_method);
+	}
+	else if ( mode == PM_THREAD )
+	{
+		SC_THREAD(see_thread);
+	}
 
 	see_qk.set_global_quantum(glob_quantum);
 	see_qk.reset();									// Re-calculate the local quantum
@@ -126,13 +149,18 @@ bridge_see::bridge_see
 	see_lmodel_tsocket.register_transport_dbg		(	this, &bridge_see::transport_dbg,		2	);
 
 	std::string parname = sc_core::sc_get_parent(this)->name();
-	see_core_obj = new see_core(parname);
+	see_core_obj = new see_core(parname, (unsigned int)lm_memory_size, (unsigned int)gvoc_memory_size, see_dec_length, rule_file);
 
 	memset( see_lm_mem.get_mem_ptr()	, 0, size_t(lm_memory_size)		);
 	memset( see_gvoc_mem.get_mem_ptr()	, 0, size_t(gvoc_memory_size)	);
 	memset( see_rep_mem.get_mem_ptr()	, 0, size_t(report_memory_size) );
 
-	see_dec_data = new unsigned char[size_t(see_act_data_length)];
+	see_dec_data = new unsigned char[size_t(see_dec_length)];
+	see_tmpl = see_pool.add_template( tlm::TLM_WRITE_COMMAND, see_dec_length );
+	if ( see_multicast )
+	{
+		see_mc.set_targets( target_number, (multicast == MC_SCATTER ? see_act_data_length : 0) );
+	}
 	see_notifcount_file = file_ops::build_filename( see_name, suffix);
 								
 }
@@ -144,45 +172,24 @@ bridge_see::bridge_see
 /// @brief Thread process D of the Node.
 //
 /// @details
-///		By every execution, it evaluates the data received from the LM 
-///		component with respect to the received gvoc data and decides 
-///		which action(s) should be taken by the node. Then it generates a write transaction
-///		to activate the corresponding actuator and pass its decision data.<br>
-///		After that read transaction is completed, it notifies the monitor,  and  
-///		suspends. It runs again after process C2.
+///		It performs the transfer of D ( see_transfer() ) each time the LM notifies it 
+///		and suspends. It runs again after process C2.
 //
-///	@see 	bridge_see::set_trans_Obj()
-/// @see 	bridge_see::execute_trans()
-///	@see	trtr::follow_transactions()
+/// @see 	bridge_see::see_transfer()
+///	@see	trtr::follow_synch()
 //
 //======================================================================
 void bridge_see::see_thread(void) //D
 {
-	unsigned int cycles_counter	= 1;
-
 	while (true)
 	{
-		wait( lmodel_to_see_vector.at(nodenbr) );
-
-		see_idelay		=	see_qk.get_local_time();
-		trtr::follow_transactions(filename, see_name, see_id,  see_idelay, trtr::T_CALL, trtr::T_IGNORE, see_id_nr);
-		see_core_obj->eval_and_decide(see_lm_mem, see_gvoc_mem, see_dec_data);
-		do_report();
-		set_trans_Obj	( see_tObj, see_adr, see_dec_data );
-		execute_trans	( see_tObj );				
-
-		if ( ( cycles_counter == m_cycle_nr_trigger) && (m_cycle_nr_trigger > 0) )
-		{
-			see_to_monitor_vector.at(nodenbr).notify();	
-			cycles_counter = 0;
-		}
+		wait( see_sync.lmodel_to_see );
 
-		see_qk.set( see_idelay );							// Update quantum keeper with time consumed by target
+		see_transfer();
 		wait( sc_core::SC_ZERO_TIME );
 
 		if ( see_qk.need_sync() )							// Check local time against quantum and sync if neccessary
 		{
-			cycles_counter++;
 			trtr::follow_synch(filename, see_name, "D", see_id, see_idelay, trtr::S_NEED);
 			see_qk.sync();
 			trtr::follow_synch(filename, see_name, "D", see_id, see_idelay, trtr::S_RETURN);
@@ -191,6 +198,121 @@ void bridge_see::see_thread(void) //D
 	}
 }
 
+
+//======================================================================
+/// @fn see_method
+//
+/// @brief Process D of the Node as SC_METHOD.
+//
+/// @details
+///		It behaves like see_thread(): each wait() of the thread is replaced 
+///		by a next_trigger() and the state #see_state in which the method is
+///		resumed.
+//
+/// @see 	bridge_see::see_thread()
+//
+//======================================================================
+void bridge_see::see_method(void) //D
+{
+	switch ( see_state )
+	{
+		case PS_START:
+			see_state = PS_TRANSFER;
+			next_trigger( see_sync.lmodel_to_see );
+			break;
+
+		case PS_TRANSFER:
+			see_transfer();
+			see_state = PS_CHECK;
+			next_trigger( sc_core::SC_ZERO_TIME );
+			break;
+
+		case PS_CHECK:
+			if ( see_qk.need_sync() )						// Check local time against quantum and sync if neccessary
+			{
+				trtr::follow_synch(filename, see_name, "D", see_id, see_idelay, trtr::S_NEED);
+				see_state = PS_SYNC;
+				next_trigger( see_qk.get_local_time() );
+			}
+			else
+			{
+				see_state = PS_TRANSFER;
+				next_trigger( see_sync.lmodel_to_see );
+			}
+			break;
+
+		case PS_SYNC:
+			see_qk.reset();
+			trtr::follow_synch(filename, see_name, "D", see_id, see_idelay, trtr::S_RETURN);
+			see_state = PS_TRANSFER;
+			next_trigger( see_sync.lmodel_to_see );
+			break;
+	}
+}
+
+
+//======================================================================
+/// @fn see_transfer
+//
+/// @brief transfer of process D, common to its thread and method implementations.
+//
+/// @details
+///		By every execution, it evaluates the data received from the LM 
+///		component with respect to the received gvoc data and decides 
+///		which action(s) should be taken by the node, looking the decision up in
+///		the decision table of see_core if there is one. Then it generates a write transaction
+///		to activate the corresponding actuator and pass its decision data. In multicast 
+///		mode, this single transaction delivers the decision, or its slices, to all 
+///		actuators and extactions through IC4.<br>
+///		After that read transaction is completed, it notifies the monitor every 
+///		m_cycle_nr_trigger process cycles and updates the quantum keeper. The process
+///		cycles are counted at the last transfer of each quantum.
+//
+/// @retval true if the monitor (E2) has been notified
+//
+///	@see 	bridge_see::set_trans_Obj()
+/// @see 	bridge_see::execute_trans()
+///	@see	trtr::follow_transactions()
+//
+//======================================================================
+bool bridge_see::see_transfer(void)
+{
+	tlm::tlm_generic_payload	*tObj;
+	bool						monitor_triggered	= false;
+
+	see_idelay		=	see_qk.get_local_time();
+	trtr::follow_transactions(filename, see_name, see_id,  see_idelay, trtr::T_CALL, trtr::T_IGNORE, see_id_nr);
+	see_core_obj->decide(see_lm_mem, see_gvoc_mem, see_dec_data);
+	do_report();
+	see_sync.see_report_version = see_rep_mem.get_version();
+	tObj			= see_pool.allocate( see_tmpl );
+	set_trans_Obj	( *tObj, see_adr, see_dec_data );
+	if ( see_multicast )
+	{
+		tObj->set_extension( &see_mc );
+	}
+	execute_trans	( *tObj );				
+	if ( see_multicast )
+	{
+		tObj->clear_extension( &see_mc );
+	}
+	tObj->release	();
+
+	if ( ( see_cycles_counter == m_cycle_nr_trigger) && (m_cycle_nr_trigger > 0) )
+	{
+		see_sync.see_to_monitor.notify();	
+		see_cycles_counter = 0;
+		monitor_triggered = true;
+	}
+
+	see_qk.set( see_idelay );							// Update quantum keeper with time consumed by target
+	if ( see_qk.need_sync() )							// last process cycle of the quantum
+	{
+		see_cycles_counter++;
+	}
+	return monitor_triggered;
+}
+
 //======================================================================
 /// @fn execute_trans
 //
@@ -218,8 +340,13 @@ void bridge_see::execute_trans( tlm::tlm_generic_payload& tObj)
 //======================================================================
 /// @fn set_trans_Obj
 //
-/// @brief uses the given parameters to build a new transaction object for
-///		each transactions initiated by SEE.
+/// @brief uses the given parameters to complete a transaction object of the
+///		pool for each transactions initiated by SEE.
+//
+/// @details
+///		All the other attributes are already set by the template of the pool.
+///		The decision data is copied into the pooled data buffer, since 
+///		#see_dec_data is also used for the report.
 //
 //======================================================================
 void bridge_see::set_trans_Obj	(	tlm::tlm_generic_payload& tObj,
@@ -227,16 +354,8 @@ void bridge_see::set_trans_Obj	(	tlm::tlm_generic_payload& tObj,
 									unsigned char* data
 								)
 {
-	tObj.set_command			( tlm::TLM_WRITE_COMMAND		);
 	tObj.set_address			( see_adr						);
-	tObj.set_data_length		( see_act_data_length			);
-	tObj.set_data_ptr			( data							);
-	tObj.set_streaming_width	( see_act_data_length			);
-	tObj.set_response_status	( tlm::TLM_INCOMPLETE_RESPONSE	);
-	tObj.set_gp_option			( tlm::TLM_MIN_PAYLOAD			);
-	tObj.set_dmi_allowed		( false							);
-	tObj.set_byte_enable_ptr	( 0								);
-	tObj.set_byte_enable_length ( 0								);
+	memcpy						( tObj.get_data_ptr(), data, size_t(see_dec_length) );
 }
 
 void bridge_see::b_transport	(	int id,
@@ -258,6 +377,10 @@ void bridge_see::b_transport	(	int id,
 
 		case 0: //(gvoc_id_nr):
 			see_gvoc_mem.operation(id, tObj, delay);
+			if ( tObj.is_write() && tObj.is_response_ok() )
+			{
+				see_core_obj->gvoc_changed(see_gvoc_mem);
+			}
 			break;
 				
 		default:
@@ -292,10 +415,44 @@ tlm::tlm_sync_enum bridge_see::nb_transport_fw	(	int id,
 	return tlm::TLM_ACCEPTED;
 }
 
+//======================================================================
+/// @fn transport_dbg
+//
+/// @brief Implementation of the debug transport for zero time accesses
+///		on the memory blocks of the SEE.
+//
+/// @details As for b_transport, the memory block is chosen by the socket
+///		receiving the call. A debug write on the gvoc memory updates the gvoc 
+///		state of the decision table ( see_core::gvoc_changed() ) like a write 
+///		through b_transport, so that no decision cached for the old gvoc data
+///		is served afterwards.
+//
+//======================================================================
 unsigned int bridge_see::transport_dbg	(	int id,
 											tlm::tlm_generic_payload& tObj )
 {
-	return 0;
+	switch(id)
+	{
+		case 2:  // (lmodel_id_nr):
+			return see_lm_mem.debug_operation(tObj);
+
+		case 1: //(monitor_id_nr) 
+			return see_rep_mem.debug_operation(tObj);
+
+		case 0: //(gvoc_id_nr):
+		{
+			unsigned int	length = see_gvoc_mem.debug_operation(tObj);
+
+			if ( tObj.is_write() && length > 0 )
+			{
+				see_core_obj->gvoc_changed(see_gvoc_mem);
+			}
+			return length;
+		}
+				
+		default:
+			return 0;
+	}
 }
 	
 //======================================================================
@@ -39,7 +39,8 @@
 ///		Its role: Bridge <br>
 ///	 	Its Initiators: LM - Monitor - GVOC through the Interconnect3 component <br>	
 ///		Its Targets: Actuators through the Interconnect4 compponent <br>
-///		Its process: D
+///		Its process: D, as SC_THREAD or, chosen at elaboration, as SC_METHOD or
+///		run by the executor thread of the node
 //
 //==============================================================================
 
@@ -54,6 +55,8 @@
 #include "constants.h"
 #include "memory.h"
 #include "see_core.h"
+#include "payload_pool.h"
+#include "multicast_extension.h"
 
 class bridge_see:		public sc_module,
 						virtual public tlm::tlm_bw_transport_if<>
@@ -77,7 +80,12 @@ public:
 				, sc_core::sc_time			lm_write_latency					///< write response delay for a single transaction on the LM memory
 				, unsigned int				cycle_trigger_nr_					///< number of interval between the execution of the monitor processes (in process cycles)
 				, sc_core::sc_time			glob_quantum						///< time value for the globl quantum
-				, unsigned int				nodenbr_							///< Position index for the vectoors of events
+				, node_sync&				sync								///< events of the node
+				, payload_pool&				pool								///< payload pool of the node
+				, process_mode				mode								///< implementation of D
+				, const char*				rule_file							///< rule file of the decision table, 0 without decision table
+				, multicast_mode			multicast							///< delivery of the decisions to the targets of IC4
+				, unsigned int				target_number						///< number of targets of IC4
 				);
 
 	SC_HAS_PROCESS ( bridge_see );
@@ -85,6 +93,13 @@ public:
 // Method Declarations =========================================================
 	void see_thread(); //thread
 
+	void see_method(); //method
+
+	bool see_transfer();
+
+	/// quantum keeper of D
+	tlm_utils::tlm_quantumkeeper& get_qk()		{ return see_qk; }
+
 
 	void execute_trans	( tlm::tlm_generic_payload& tObj								///< ref to transaction object
 						);
@@ -143,18 +158,25 @@ private:
 	std::string						see_name	;										///< module name
 	const unsigned int				see_id		;										///< see component id
 	const unsigned int				see_gvoc_mem_size, see_lm_mem_size, see_rep_mem_size; ///< sizes of the reserved memory blocks
-	tlm::tlm_generic_payload		see_tObj	;										///< transaction object
+	payload_pool&					see_pool	;										///< payload pool of the node
+	node_sync&						see_sync	;										///< events of the node
+	unsigned int					see_actions_status;									///< result of the last write of see actions
+	unsigned int					see_tmpl	;										///< template index of the write transactions in the pool
 	unsigned int					see_data, see_adr;									///< transaction data and start adress
 	unsigned int					see_rep_data_length, see_act_data_length;			///< transaction data length
+	unsigned int					see_dec_length;										///< length of the decision data, a slice of see_act_data_length per target when scattered
+	bool							see_multicast;										///< delivery of the decisions to several targets in one transaction
+	multicast_extension				see_mc;												///< targets of the multicast transactions
 	tlm_utils::tlm_quantumkeeper	see_qk		;										///< quantum keeper
 	sc_core::sc_time 				see_idelay	;										///< transaction delay for temporal decoupling
 	memory							see_lm_mem, see_gvoc_mem, see_rep_mem;				///< memory objects
 	unsigned int					m_cycle_nr_trigger;									///< user specification with which the monitor component
+	unsigned int					see_cycles_counter;									///< process cycles since the last trigger of the monitor
+	process_state					see_state	;										///< state of D as SC_METHOD
 	see_core						*see_core_obj;										
 	sc_dt::uchar					*see_dec_data;										///< data pointer 
 
 	void set_target_idx				(	int id	);										/// defines the target component of the transaction by setting #see_target_idx	
-	unsigned int					nodenbr;
 	std::string						see_notifcount_file;
 
 };
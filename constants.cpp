@@ -28,8 +28,3 @@
 */
 
 #include "constants.h"
-
-sc_core::sc_vector <sc_core::sc_event> monitor_ev_vector		("monitor_event_"		, NUMB_OF_NODES	)	;
-sc_core::sc_vector <sc_core::sc_event> see_to_monitor_vector	("see_to_monitor_event_", NUMB_OF_NODES )	;
-sc_core::sc_vector <sc_core::sc_event> lmodel_to_see_vector		("lmodel_to_see_event_"	, NUMB_OF_NODES	)	;
-sc_core::sc_vector <sc_core::sc_event> lmodel_to_monitor_vector	("lmodel_to_monitor_"	, NUMB_OF_NODES	)	;
\ No newline at end of file
@@ -74,6 +74,56 @@
 	const unsigned int			buswidth4				=	32				;				///< (in Bytes) max data length pro transaction over sockets
 	const unsigned int			buswidth5				=	32				;				///< (in Bytes) max data length pro transaction over sockets
 
+	//address window of each target of a router for the debug transport interface
+	const sc_dt::uint64			dbg_window_size			=	0x100000000ULL	;				///< size of the address window of each target of a router for transport_dbg: address = socket index * dbg_window_size + target address
+
+	//chunk size of the streaming reader for the input files
+	const unsigned int			stream_chunk_size		=	1 << 20			;				///< (in Bytes) size of each of the buffers of a stream_reader
+	const unsigned int			stream_chunk_count		=	4				;				///< number of buffers of a stream_reader, the prefetch thread fills up to count-1 of them in advance
+	const unsigned int			trace_index_stride		=	64				;				///< number of blocks of a trace file between two entries of its index
+
+	//behaviour of the stimulus sources at the end of their input
+	enum input_end_mode
+	{
+		INPUT_LOOP,																					///< restarts from the beginning of the input
+		INPUT_HOLD,																					///< repeats the last dataset
+		INPUT_STOP																					///< stops the simulation
+	};
+
+	//implementation of the processes of a node
+	enum process_mode
+	{
+		PM_THREAD,																					///< each process is an SC_THREAD
+		PM_METHOD,																					///< the bridge processes are SC_METHODs, the other ones SC_THREADs
+		PM_EXECUTOR																					///< the components have no process, the executor thread of the node runs the process cycle
+	};
+
+	//states of the bridge processes implemented as SC_METHODs
+	enum process_state
+	{
+		PS_START,																					///< first activation, waits for the first trigger
+		PS_TRANSFER,																				///< performs the transfer of the process cycle
+		PS_CHECK,																					///< checks the local time against the quantum
+		PS_SYNC																						///< returns from the synchronization with the quantum
+	};
+
+	//delivery of the see decisions to the targets of IC4
+	enum multicast_mode
+	{
+		MC_NONE,																					///< one decision to the target given by #see_target_idx
+		MC_BROADCAST,																				///< the same decision to all targets in one transaction
+		MC_SCATTER																					///< one slice of the decision data to each target in one transaction
+	};
+
+	//capacity of the message channels between the nodes
+	const unsigned int			message_fifo_size		=	4096			;				///< (in Bytes) capacity of a message fifo, length prefixes included
+
+	//decision table of the see
+	const unsigned int			see_decision_cache_size	=	256				;				///< number of decisions cached by the see
+
+	//alignment of the ring buffers of the block fifo channels
+	const unsigned int			cache_line_size			=	64				;				///< (in Bytes) size of a cache line of the host
+
 	//schould be set before each simulation
 	const sc_core::sc_time_unit node_time_unit			=	sc_core::SC_MS	;				///< time unit in the model. It could be changed by the user, if necessary
 
@@ -85,18 +135,27 @@
 	extern unsigned int			see_target_idx					;							///< index of the see target for a transaction
 	extern unsigned int			ic1_initiator_idx				;							///< index of the memory subarea of an sae initiator on the sae memory
 
-	//event to trigger processes
-	extern	sc_core::sc_vector <sc_core::sc_event>	lmodel_to_monitor_vector;				///< vector of notified events after a transaction between lmodel and sae (C1 to E1) 	
-	extern  sc_core::sc_vector <sc_core::sc_event>	lmodel_to_see_vector	;				///< vector of notified events after a transaction between lmodel and see (C2 to D)
-	extern	sc_core::sc_vector <sc_core::sc_event>	see_to_monitor_vector	;				///< vector of notified events after a transaction between see and actuator or extaction (D to E2)
-	extern	sc_core::sc_vector <sc_core::sc_event>	monitor_ev_vector		;				///< vector of notified events after a transaction between lmodel and (C1 to C2 or E1 to C2) 
+	//events to trigger the processes of a node and versions of its report memories, owned by its lt_pnode_top
+	struct node_sync
+	{
+		sc_core::sc_event		lmodel_to_monitor		;									///< notified after a transaction between lmodel and sae (C1 to E1)
+		sc_core::sc_event		lmodel_to_see			;									///< notified after a transaction between lmodel and see (C2 to D)
+		sc_core::sc_event		see_to_monitor			;									///< notified after a transaction between see and actuator or extaction (D to E2)
+		sc_core::sc_event		monitor_ev				;									///< notified after a transaction between lmodel and (C1 to C2 or E1 to C2)
+		sc_core::sc_event		sae_cycle_ev			;									///< notified by the sae when all its initiators have written their datasets of the cycle
+		bool					sae_cycle_complete		;									///< set by the sae with #sae_cycle_ev, cleared by lmodel when it starts reading the cycle
+		unsigned int			lm_report_version		;									///< version of the LM report memory, published by lmodel
+		unsigned int			see_report_version		;									///< version of the SEE report memory, published by see
+
+		node_sync() : sae_cycle_complete(false), lm_report_version(0), see_report_version(0) {}
+	};
 
 
 //Konstanten /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#define NUMB_OF_NODES	1																	///< number of node in the node in the system under unvestigation
 #define INPUTDIR	"C:/***/input/"															///< storage location for input files
 #define OUTPUTDIR	"C:/***/output/"														///< storage location for output files
+//#define USE_ZLIB																			///< reads gzip/zlib compressed input files (link with zlib)
 
 	typedef sc_dt::uchar			datyp						;							///< data type in the model
 	#define str_size				1														///< string size when converting data from type datyp to string and vice-versa
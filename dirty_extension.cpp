@@ -0,0 +1,83 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "dirty_extension.h"
+
+
+//======================================================================
+/// @fn dirty_extension
+//
+/// @brief constructor. No flag is filled.
+//
+//======================================================================
+dirty_extension::dirty_extension ( void )
+{
+}
+
+
+//======================================================================
+/// @fn clone
+//
+/// @brief returns a copy of the extension
+//
+//======================================================================
+tlm::tlm_extension_base* dirty_extension::clone ( void ) const
+{
+	dirty_extension		*ext = new dirty_extension;
+
+	ext->de_dirty = de_dirty;
+	return ext;
+}
+
+
+//======================================================================
+/// @fn copy_from
+//
+/// @brief copies the flags of another dirty extension
+//
+//======================================================================
+void dirty_extension::copy_from ( const tlm::tlm_extension_base& ext )
+{
+	de_dirty = static_cast<const dirty_extension&>(ext).de_dirty;
+}
+
+
+//======================================================================
+/// @fn is_dirty
+//
+/// @brief returns the flag of a slot of the read data
+//
+/// @retval true if the slot was written since it was last read or if the
+///		memory didn't fill the flags
+//
+//======================================================================
+bool dirty_extension::is_dirty ( unsigned int slot ) const
+{
+	return ( slot >= de_dirty.size() ) || de_dirty[slot];
+}
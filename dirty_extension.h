@@ -0,0 +1,68 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file dirty_extension.h
+//
+///  @brief This is the extension of a read transaction which returns the 
+///		dirty flags of the memory slots it reads
+///
+///  @details
+///		A memory with dirty tracking ( memory::track_dirty() ) fills the flags of
+///		the slots covered by a read transaction carrying this extension and 
+///		clears them, i.e. the initiator consumes the slots. Without dirty 
+///		tracking the flags stay empty and all slots are to be considered dirty.
+//		
+//==============================================================================
+
+#ifndef __DIRTY_EXTENSION_H__
+#define __DIRTY_EXTENSION_H__
+
+#include <systemc.h>
+#include <tlm.h>
+#include <vector>
+
+class dirty_extension : public tlm::tlm_extension<dirty_extension>
+{
+public:
+
+	dirty_extension						( void );
+
+	virtual tlm::tlm_extension_base* clone	( void ) const;
+
+	virtual void copy_from				( const tlm::tlm_extension_base& ext		///< extension to be copied
+										);
+
+	bool is_dirty						( unsigned int slot							///< index of the slot in the read data
+										) const;
+
+	std::vector<bool>		de_dirty;												///< dirty flags of the read slots, filled by the memory
+};
+
+#endif /*__DIRTY_EXTENSION_H__*/
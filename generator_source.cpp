@@ -0,0 +1,174 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+
+#include "generator_source.h"
+
+static const double	two_pi	= 6.283185307179586;
+
+
+//======================================================================
+/// @fn generator_source
+//
+/// @brief constructor
+//
+//======================================================================
+generator_source::generator_source ( const generator_config& config )
+	: gs_config	( config )
+{
+	if ( gs_config.period == 0 )
+	{
+		gs_config.period = 1;
+	}
+	rewind();
+}
+
+
+//======================================================================
+/// @fn read
+//
+/// @brief computes the next values of the generator
+//
+/// @details A generator never runs out of data.
+//
+//======================================================================
+size_t generator_source::read ( datyp* data, size_t count )
+{
+	const generator_config	&cfg	= gs_config;
+
+	for ( size_t i = 0; i < count; i++, gs_sample++ )
+	{
+		double	value;
+
+		switch ( cfg.kind )
+		{
+		case GEN_RAMP:
+			value = cfg.base + cfg.amplitude * double(gs_sample % cfg.period);
+			break;
+		case GEN_SINE:
+			value = cfg.base + cfg.amplitude * sin( two_pi * double(gs_sample % cfg.period) / double(cfg.period) );
+			break;
+		case GEN_NOISE:
+			value = cfg.base + cfg.amplitude * noise();
+			break;
+		default:
+			value = cfg.base;
+			break;
+		}
+
+		if ( gs_sample >= cfg.fault_start )
+		{
+			value += cfg.step + cfg.drift * double(gs_sample - cfg.fault_start);
+		}
+
+		if ( cfg.burst_every > 0 && (gs_sample % cfg.burst_every) < cfg.burst_length )
+		{
+			data[i] = cfg.burst_value;
+		}
+		else if ( value <= 0.0 )
+		{
+			data[i] = 0;
+		}
+		else if ( value >= 255.0 )
+		{
+			data[i] = 255;
+		}
+		else
+		{
+			data[i] = datyp( value + 0.5 );
+		}
+	}
+	return count;
+}
+
+
+//======================================================================
+/// @fn rewind
+//
+/// @brief restarts the generator at its first sample with its seed
+//
+//======================================================================
+bool generator_source::rewind ( void )
+{
+	gs_sample		= 0;
+	gs_state		= 0x9E3779B97F4A7C15ULL ^ gs_config.seed;
+	gs_spare		= 0.0;
+	gs_has_spare	= false;
+	return true;
+}
+
+
+//======================================================================
+/// @fn uniform
+//
+/// @brief returns a uniform value in [0, 1) from a xorshift64* generator
+//
+//======================================================================
+double generator_source::uniform ( void )
+{
+	gs_state ^= gs_state >> 12;
+	gs_state ^= gs_state << 25;
+	gs_state ^= gs_state >> 27;
+	return double( (gs_state * 0x2545F4914F6CDD1DULL) >> 11 ) / 9007199254740992.0;
+}
+
+
+//======================================================================
+/// @fn noise
+//
+/// @brief returns a standard normal value
+//
+/// @details The uniform values are transformed with Box-Muller, so that the
+///		sequence doesn't depend on the distributions of the standard library.
+///		It is the same for the same seed and build; the results of log, sin
+///		and cos may differ in their last bits between toolchains.
+//
+//======================================================================
+double generator_source::noise ( void )
+{
+	double	u1, u2, r;
+
+	if ( gs_has_spare )
+	{
+		gs_has_spare = false;
+		return gs_spare;
+	}
+
+	do
+	{
+		u1 = uniform();
+	} while ( u1 <= 0.0 );
+	u2 = uniform();
+
+	r				= sqrt( -2.0 * log(u1) );
+	gs_spare		= r * sin( two_pi * u2 );
+	gs_has_spare	= true;
+	return r * cos( two_pi * u2 );
+}
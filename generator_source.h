@@ -0,0 +1,108 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file generator_source.h
+//
+///  @brief This is the synthetic stimulus source for the senenv_fifo_input module
+//
+///  @details
+///		The source computes its values on the fly, so that large nodes can be 
+///		simulated without any input file. The values are deterministic: a run is
+///		reproduced by the seed of the configuration with the same build. <br>
+///		The base signal (constant, ramp, sine or gaussian noise) can be altered
+///		by a step and a drift fault from a given sample on, and by periodic
+///		bursts of an out-of-band value to trip the evaluation of the LM. <br>
+///		The values are rounded and saturated to the range of #datyp.
+//		
+//==============================================================================
+
+#ifndef __GENERATOR_SOURCE_H__
+#define __GENERATOR_SOURCE_H__
+
+#include "constants.h"
+#include "stimulus_source.h"
+
+/// base signal of a generator
+enum generator_kind
+{
+	GEN_CONSTANT,															///< base
+	GEN_RAMP,																///< base + amplitude * (n % period)
+	GEN_SINE,																///< base + amplitude * sin(2 pi n / period)
+	GEN_NOISE																///< gaussian noise with mean base and standard deviation amplitude
+};
+
+/// configuration of a generator
+struct generator_config
+{
+	generator_config	( void )
+		: kind(GEN_CONSTANT), base(0), amplitude(0), period(1), seed(1)
+		, fault_start(0), step(0), drift(0)
+		, burst_every(0), burst_length(0), burst_value(0)
+	{}
+
+	generator_kind		kind;												///< base signal
+	double				base;												///< level, start value or mean of the signal
+	double				amplitude;											///< slope, amplitude or standard deviation of the signal
+	unsigned int		period;												///< period of the ramp and of the sine (samples)
+	unsigned int		seed;												///< seed of the noise
+	sc_dt::uint64		fault_start;										///< first sample with the step and drift faults
+	double				step;												///< offset added from fault_start on
+	double				drift;												///< offset added per sample from fault_start on
+	unsigned int		burst_every;										///< period of the bursts (samples), 0 for no burst
+	unsigned int		burst_length;										///< length of a burst (samples)
+	datyp				burst_value;										///< out-of-band value of the bursts
+};
+
+
+class generator_source : public stimulus_source
+{
+public:
+
+	generator_source	( const generator_config& config					///< configuration of the generator
+						);
+
+	size_t read			( datyp* data, size_t count );
+
+	bool rewind			( void );
+
+private:
+
+	double				uniform		( void );
+
+	double				noise		( void );
+
+	generator_config	gs_config;
+	sc_dt::uint64		gs_sample;											///< index of the next sample
+	sc_dt::uint64		gs_state;											///< state of the random number generator
+	double				gs_spare;											///< second value of the last Box-Muller pair
+	bool				gs_has_spare;
+};
+
+#endif /*__GENERATOR_SOURCE_H__*/
@@ -0,0 +1,178 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "gvoc_schedule.h"
+#include "reporting.h"
+
+static const char *filename = "gvoc_schedule.cpp";
+
+
+//======================================================================
+/// @fn gvoc_schedule
+//
+/// @brief constructor. The schedule is empty.
+//
+//======================================================================
+gvoc_schedule::gvoc_schedule ( void )
+{
+}
+
+
+//======================================================================
+/// @fn load
+//
+/// @brief adds the records of a schedule file
+//
+/// @retval false if the file couldn't be opened
+//
+//======================================================================
+bool gvoc_schedule::load ( const char* file_name )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(INPUTDIR) + std::string(file_name);
+	std::ifstream		infile( strfname.c_str() );
+	std::string			line;
+
+	if ( !infile.is_open() )
+	{
+		msg << "i couldn't open file " << strfname << "!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		return false;
+	}
+
+	while ( std::getline(infile, line) )
+	{
+		std::istringstream	fields( line );
+		std::vector<datyp>	data;
+		double				start;
+		unsigned int		value;
+
+		if ( line.empty() || line[0] == '#' || !(fields >> start) )
+		{
+			continue;
+		}
+		while ( fields >> value )
+		{
+			data.push_back( datyp(value) );
+		}
+		add( sc_core::sc_time(start, node_time_unit), data.empty() ? 0 : &data[0], (unsigned int)data.size() );
+	}
+	return true;
+}
+
+
+//======================================================================
+/// @fn add
+//
+/// @brief inserts a record, keeping the records ordered by start time
+//
+/// @details A record with the same start time as an existing one is 
+///		inserted after it and thus replaces it.
+//
+//======================================================================
+void gvoc_schedule::add ( const sc_core::sc_time& start, const datyp* data, unsigned int length )
+{
+	gvoc_record		record;
+	unsigned int	pos		= size();
+
+	record.r_start	= start;
+	record.r_data.assign( data, data + length );
+
+	while ( pos > 0 && start < gs_records[pos - 1].r_start )
+	{
+		pos--;
+	}
+	gs_records.insert( gs_records.begin() + pos, record );
+}
+
+
+//======================================================================
+/// @fn active
+//
+/// @brief looks up the record active at the given time by bisection
+//
+/// @retval index of the record, -1 if no record has started yet
+//
+//======================================================================
+int gvoc_schedule::active ( const sc_core::sc_time& time ) const
+{
+	int		low		= -1;
+	int		high	= int(gs_records.size());
+
+	// last record whose start time isn't after time
+	while ( high - low > 1 )
+	{
+		int mid = (low + high) / 2;
+		if ( gs_records[mid].r_start <= time )
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	return low;
+}
+
+
+//======================================================================
+/// @fn copy_record
+//
+/// @brief copies the data of a record into a transaction buffer
+//
+/// @details The data is truncated or zero padded to the buffer length.
+//
+//======================================================================
+void gvoc_schedule::copy_record ( int idx, unsigned char* data, unsigned int length ) const
+{
+	unsigned int	copied	= 0;
+
+	if ( idx >= 0 && idx < int(gs_records.size()) )
+	{
+		const std::vector<datyp> &rec = gs_records[idx].r_data;
+		copied = std::min( length, (unsigned int)rec.size() );
+		if ( copied > 0 )
+		{
+			memcpy( data, &rec[0], copied );
+		}
+	}
+	memset( data + copied, 0, size_t(length - copied) );
+}
+
+
+unsigned int gvoc_schedule::size ( void ) const
+{
+	return (unsigned int)gs_records.size();
+}
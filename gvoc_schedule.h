@@ -0,0 +1,91 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file gvoc_schedule.h
+//
+///  @brief This is the time indexed schedule of the goals, values, objectives 
+///		and constraints of a node
+//
+///  @details
+///		Each record of the schedule holds the g.v.o.c. data which is active from
+///		its start time until the start time of the next record. The GVOC 
+///		component looks up the active record of the current simulated time and 
+///		only transfers the data when this record changes. <br>
+///		A schedule file has one record per line: the start time in #node_time_unit
+///		followed by the data bytes as decimal values. Lines starting with '#' are
+///		ignored.
+//		
+//==============================================================================
+
+#ifndef __GVOC_SCHEDULE_H__
+#define __GVOC_SCHEDULE_H__
+
+#include <systemc.h>
+#include <vector>
+
+#include "constants.h"
+
+class gvoc_schedule
+{
+public:
+
+	gvoc_schedule		( void );
+
+	bool load			( const char* file_name								///< schedule file name, relative to INPUTDIR
+						);
+
+	void add			( const sc_core::sc_time& start,					///< start time of the record
+						  const datyp* data,								///< data of the record
+						  unsigned int length								///< length of the data
+						);
+
+	int active			( const sc_core::sc_time& time						///< simulated time
+						) const;
+
+	void copy_record	( int idx,											///< index of the record returned by active()
+						  unsigned char* data,								///< destination buffer
+						  unsigned int length								///< length of the destination buffer, the rest of it is zeroed
+						) const;
+
+	unsigned int size	( void ) const;
+
+private:
+
+	/// g.v.o.c. data active from its start time on
+	struct gvoc_record
+	{
+		sc_core::sc_time		r_start;
+		std::vector<datyp>		r_data;
+	};
+
+	std::vector<gvoc_record>	gs_records;								///< records ordered by start time
+};
+
+#endif /*__GVOC_SCHEDULE_H__*/
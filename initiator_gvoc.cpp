@@ -27,6 +27,8 @@
 *    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+
 #include "initiator_gvoc.h"
 #include "constants.h"
 #include "reporting.h"
@@ -41,10 +43,17 @@ static const char	*filename		=	"initiator_gvoc.cpp";				///< filename for report
 /// @brief constructor
 //
 /// @details 
-///		declares the thread process ( gvoc_thread() ) of this component.
+///		declares the thread processes ( gvoc_monitor_thread(), gvoc_see_thread() ) 
+///		of this component, unless the node runs them in its executor thread.
 ///		<br>binds the initiator socket to the module. <br>
 ///		sets the global quantum and re-calculates the local quantum for
-///		temporal decoupling.	  
+///		temporal decoupling. <br>
+///		registers the templates of its write transactions in the payload pool
+///		and loads the schedule of the g.v.o.c. data.</br>
+///		Without schedule file, the record of prepare_datablock() is active
+///		from the start of the simulation. If the schedule file is empty or
+///		can't be read, this record is written continuously like before the
+///		schedule existed.
 //
 //================================================================================
 initiator_gvoc::initiator_gvoc	( sc_module_name		module_name									///< sc module name
@@ -54,6 +63,10 @@ initiator_gvoc::initiator_gvoc	( sc_module_name		module_name									///< sc mod
 								  , const unsigned int	see_nr_dataset_cycle						///< number of gvoc datasets pro cycle for the see component
 								  , const unsigned int	monitor_nr_dataset_cycle					///< number of gvoc datasets pro cycle for the monitor component
 								  , sc_core::sc_time	glob_quantum								///< time value for the global quantum	
+								  , payload_pool&		pool										///< payload pool of the node
+								  , const char*			schedule_file								///< schedule file name, 0 for the default record
+								  , sc_core::sc_time	refresh_interval							///< interval to resend an unchanged record, SC_ZERO_TIME to send only changes
+								  , process_mode		mode										///< PM_EXECUTOR: no own thread processes
 								): 
 								  gvoc_name					(	name()						)
 								, gvoc_id					(	ID							)
@@ -66,11 +79,28 @@ initiator_gvoc::initiator_gvoc	( sc_module_name		module_name									///< sc mod
 								, gvoc_see_adr_start		(	0							)
 								, gvoc_see_delay			( sc_core::sc_time(0, node_time_unit) )
 								, gvoc_m_delay				( sc_core::sc_time(0, node_time_unit) )
+								, gvoc_pool					(	pool						)
+								, gvoc_quantum				(	glob_quantum				)
+								, gvoc_refresh				(	refresh_interval			)
+								, gvoc_m_record				(	-1							)
+								, gvoc_see_record			(	-1							)
+								, gvoc_m_sent				(	sc_core::SC_ZERO_TIME		)
+								, gvoc_see_sent				(	sc_core::SC_ZERO_TIME		)
+								, gvoc_m_pending			(	0							)
+								, gvoc_see_pending			(	0							)
+								, gvoc_continuous			(	false						)
 {
-	SC_THREAD( gvoc_see_thread );
-	SC_THREAD( gvoc_monitor_thread );
+	std::ostringstream	msg;
+
+	if ( mode != PM_EXECUTOR )
+	{
+		SC_THREAD( gvoc_see_thread );
+		SC_THREAD( gvoc_monitor_thread );
+	}
 
 	gvoc_isocket.bind( *this );
+	gvoc_m_tmpl		= gvoc_pool.add_template( tlm::TLM_WRITE_COMMAND, gvoc_monitor_data_length	);
+	gvoc_see_tmpl	= gvoc_pool.add_template( tlm::TLM_WRITE_COMMAND, gvoc_see_data_length		);
 
 	gvoc_see_qk.set_global_quantum ( glob_quantum );	
 	gvoc_see_qk.reset();								
@@ -78,8 +108,17 @@ initiator_gvoc::initiator_gvoc	( sc_module_name		module_name									///< sc mod
 	gvoc_m_qk.set_global_quantum ( glob_quantum );	
 	gvoc_m_qk.reset();	
 	
-	gvoc_data = new unsigned char[size_t(gvoc_see_data_length)];
-	memset(gvoc_data, 0, size_t(gvoc_see_data_length));
+	if ( schedule_file != 0 && ( !gvoc_sched.load(schedule_file) || gvoc_sched.size() == 0 ) )
+	{
+		msg << "\t no record loaded from the gvoc schedule " << schedule_file 
+			<< ", the default record is written in every cycle";
+		WARNING_LOG(filename, __FUNCTION__, msg.str());
+		gvoc_continuous = true;
+	}
+	if ( gvoc_sched.size() == 0 )
+	{
+		prepare_datablock();
+	}
 }
 
 //======================================================================
@@ -87,18 +126,13 @@ initiator_gvoc::initiator_gvoc	( sc_module_name		module_name									///< sc mod
 //
 /// @brief Thread process A1 of the process cycle of the Node.
 //
-/// @details  It sets new transactions objects with the goals, values, objectives and constraints data 
-///		for the Monitor component and explicitely indicates the target before each call to ensure that 
-///		IC3 forwards it to the appropriate target.
+/// @details  It performs the transfers of A1 ( gvoc_monitor_transfer() ) until the end of
+///		the quantum and synchronizes.
 //
-/// @see	initiator_gvoc::prepare_datablock()
-/// @see	initiator_gvoc::set_target_idx()
-///	@see	initiator_gvoc::set_trans_Obj()
-/// @see 	initiator_gvoc::execute_trans()
+/// @see	initiator_gvoc::gvoc_monitor_transfer()
 //======================================================================
 void initiator_gvoc::gvoc_monitor_thread(void)   //Process A1
 {
-	unsigned int j = 0;
 	std::ostringstream	msg;  
 
 	wait( SC_ZERO_TIME );
@@ -108,21 +142,9 @@ void initiator_gvoc::gvoc_monitor_thread(void)   //Process A1
 		msg << "\t PROZESS A1";
 		INFO_LOG(filename, __FUNCTION__ , msg.str());
 
-		gvoc_m_delay		= gvoc_m_qk.get_local_time();
-		prepare_datablock();
-				
-		set_target_idx		( monitor_id_nr);
-		set_trans_Obj		( gvoc_tObj, gvoc_m_adr_start, gvoc_data);
-		execute_trans		( gvoc_tObj, monitor_id_nr, gvoc_m_delay  );
-		if(gvoc_m_dataset_cycle>1)
-		{
-			gvoc_m_adr_start	+= gvoc_monitor_data_length;
-		}
-
-		gvoc_m_qk.set( gvoc_m_delay );							// Update quantum keeper with time consumed by target
+		gvoc_monitor_transfer();
 		if ( gvoc_m_qk.need_sync() ) 
 		{
-			gvoc_m_adr_start	= 0; j= 0;
 			trtr::follow_synch	(filename, gvoc_name, "A1", gvoc_id, gvoc_m_delay,trtr::S_NEED);
 			gvoc_m_qk.sync		();								// Check local time against quantum and sync if neccessary
 			trtr::follow_synch	(filename, gvoc_name, "A1", gvoc_id, gvoc_m_delay,trtr::S_RETURN);
@@ -136,19 +158,14 @@ void initiator_gvoc::gvoc_monitor_thread(void)   //Process A1
 //
 /// @brief Thread process A2 of the process cycle of the Node.
 //
-/// @details  It sets new transactions objects with the goals, values, objectives and constraints data 
-///		for the SEE component and explicitely indicates the target before each call to ensure that 
-///		IC3 forwards the call to the appropriate target.
+/// @details  It performs the transfers of A2 ( gvoc_see_transfer() ) until the end of
+///		the quantum and synchronizes.
 //
-/// @see	initiator_gvoc::prepare_datablock()
-/// @see	initiator_gvoc::set_target_idx()
-///	@see	initiator_gvoc::set_trans_Obj()
-/// @see 	initiator_gvoc::execute_trans()
+/// @see	initiator_gvoc::gvoc_see_transfer()
 //======================================================================
 void initiator_gvoc::gvoc_see_thread(void)   //Process A2
 {
 	//schickt values-constraints an Monitor
-	unsigned int j = 0;
 	std::ostringstream	msg;
 		
 	wait( 0.1, node_time_unit );
@@ -158,30 +175,119 @@ void initiator_gvoc::gvoc_see_thread(void)   //Process A2
 		msg << "\t PROZESS A2";
 		INFO_LOG(filename, __FUNCTION__ , msg.str());
 
-		prepare_datablock();
+		gvoc_see_transfer();
 
-		gvoc_see_delay				=	gvoc_see_qk.get_local_time();
+		if ( gvoc_see_qk.need_sync() ) 
+		{
+			trtr::follow_synch	(filename, gvoc_name, "A2", gvoc_id, gvoc_see_delay,trtr::S_NEED);
 
-		set_target_idx		( see_id_nr );
-		set_trans_Obj		( gvoc_tObj, gvoc_see_adr_start, gvoc_data );
-		execute_trans		( gvoc_tObj, see_id_nr, gvoc_see_delay );
+			gvoc_see_qk.sync	();								// Check local time against quantum and sync if neccessary
+			trtr::follow_synch	(filename, gvoc_name, "A2", gvoc_id, gvoc_see_delay,trtr::S_RETURN);			
+		}
+	}
+}
 
-		if(gvoc_see_dataset_cycle>1)
+
+//======================================================================
+/// @fn gvoc_monitor_transfer
+//
+/// @brief transfer of process A1, common to its thread and the executor of the node.
+//
+/// @details  It sets new transactions objects with the goals, values, objectives and constraints data 
+///		for the Monitor component and explicitely indicates the target before each call to ensure that 
+///		IC3 forwards it to the appropriate target. <br>
+///		The datasets are only sent when the active record of the schedule changes or the refresh
+///		interval expires, otherwise the local time is advanced to the end of the current quantum.
+///		Only the datasets which fit before the end of the quantum are sent.
+///		After the last transfer of a quantum, the start address is reset.
+//
+/// @see	initiator_gvoc::update_schedule()
+/// @see	initiator_gvoc::set_target_idx()
+///	@see	initiator_gvoc::set_trans_Obj()
+/// @see 	initiator_gvoc::execute_trans()
+//======================================================================
+void initiator_gvoc::gvoc_monitor_transfer(void)
+{
+	tlm::tlm_generic_payload	*tObj;
+
+	gvoc_m_delay		= gvoc_m_qk.get_local_time();
+
+	if ( update_schedule( gvoc_m_qk.get_current_time(), gvoc_m_record, gvoc_m_sent, gvoc_m_pending, gvoc_m_dataset_cycle ) )
+	{
+		set_target_idx		( monitor_id_nr);
+		tObj				= gvoc_pool.allocate( gvoc_m_tmpl );
+		set_trans_Obj		( *tObj, gvoc_m_adr_start, gvoc_m_record);
+		execute_trans		( *tObj, monitor_id_nr, gvoc_m_delay  );
+		tObj->release		();
+		fit_in_quantum		( sc_core::sc_time_stamp() + gvoc_m_delay, gvoc_m_delay - gvoc_m_qk.get_local_time(), gvoc_m_pending );
+		if(gvoc_m_dataset_cycle>1)
 		{
-			gvoc_see_adr_start	+= gvoc_see_data_length;
+			gvoc_m_adr_start	+= gvoc_monitor_data_length;
 		}
+	}
+	else
+	{
+		gvoc_m_delay		+= time_to_quantum_end( gvoc_m_qk.get_current_time() );	// nothing to send in this quantum
+	}
 
-		gvoc_see_qk.set( gvoc_see_delay );						// Update quantum keeper with time consumed by target
+	gvoc_m_qk.set( gvoc_m_delay );							// Update quantum keeper with time consumed by target
+	if ( gvoc_m_qk.need_sync() ) 
+	{
+		gvoc_m_adr_start	= 0;
+		gvoc_m_pending		= 0;							// no dataset of this quantum in the next one
+	}
+}
 
-		if ( gvoc_see_qk.need_sync() ) 
-		{
-			gvoc_see_adr_start	= 0; j = 0;
-			trtr::follow_synch	(filename, gvoc_name, "A2", gvoc_id, gvoc_see_delay,trtr::S_NEED);
 
-			gvoc_see_qk.sync	();								// Check local time against quantum and sync if neccessary
-			trtr::follow_synch	(filename, gvoc_name, "A2", gvoc_id, gvoc_see_delay,trtr::S_RETURN);			
+//======================================================================
+/// @fn gvoc_see_transfer
+//
+/// @brief transfer of process A2, common to its thread and the executor of the node.
+//
+/// @details  It sets new transactions objects with the goals, values, objectives and constraints data 
+///		for the SEE component and explicitely indicates the target before each call to ensure that 
+///		IC3 forwards the call to the appropriate target. <br>
+///		The datasets are only sent when the active record of the schedule changes or the refresh
+///		interval expires, otherwise the local time is advanced to the end of the current quantum.
+///		Only the datasets which fit before the end of the quantum are sent.
+///		After the last transfer of a quantum, the start address is reset.
+//
+/// @see	initiator_gvoc::update_schedule()
+/// @see	initiator_gvoc::set_target_idx()
+///	@see	initiator_gvoc::set_trans_Obj()
+/// @see 	initiator_gvoc::execute_trans()
+//======================================================================
+void initiator_gvoc::gvoc_see_transfer(void)
+{
+	tlm::tlm_generic_payload	*tObj;
+
+	gvoc_see_delay				=	gvoc_see_qk.get_local_time();
+
+	if ( update_schedule( gvoc_see_qk.get_current_time(), gvoc_see_record, gvoc_see_sent, gvoc_see_pending, gvoc_see_dataset_cycle ) )
+	{
+		set_target_idx		( see_id_nr );
+		tObj				= gvoc_pool.allocate( gvoc_see_tmpl );
+		set_trans_Obj		( *tObj, gvoc_see_adr_start, gvoc_see_record );
+		execute_trans		( *tObj, see_id_nr, gvoc_see_delay );
+		tObj->release		();
+		fit_in_quantum		( sc_core::sc_time_stamp() + gvoc_see_delay, gvoc_see_delay - gvoc_see_qk.get_local_time(), gvoc_see_pending );
+
+		if(gvoc_see_dataset_cycle>1)
+		{
+			gvoc_see_adr_start	+= gvoc_see_data_length;
 		}
 	}
+	else
+	{
+		gvoc_see_delay		+= time_to_quantum_end( gvoc_see_qk.get_current_time() );	// nothing to send in this quantum
+	}
+
+	gvoc_see_qk.set( gvoc_see_delay );						// Update quantum keeper with time consumed by target
+	if ( gvoc_see_qk.need_sync() ) 
+	{
+		gvoc_see_adr_start	= 0;
+		gvoc_see_pending	= 0;							// no dataset of this quantum in the next one
+	}
 }
 
 
@@ -266,36 +372,108 @@ tlm::tlm_sync_enum initiator_gvoc::nb_transport_bw( tlm::tlm_generic_payload& tO
 //======================================================================
 /// @fn set_trans_Obj
 //
-/// @brief uses the given parameters to set the parameters of the given transaction object
+/// @brief uses the given parameters to complete a transaction object of the pool
 ///		for the next transaction 
 //
+/// @details
+///		The data length of the transaction object is set by the template of the
+///		target component. The data of the schedule record is copied into its pooled
+///		data buffer.
+//
 //======================================================================
 void initiator_gvoc::set_trans_Obj(	tlm::tlm_generic_payload& tObj,
 									const sc_dt::uint64 &adr,
-									unsigned char* data)
+									int record)
 {
-	unsigned int data_length;
-			
-	tObj.set_command			(	tlm::TLM_WRITE_COMMAND	);
 	tObj.set_address			(	adr						);
-	tObj.set_data_ptr			(	data					);
-	tObj.set_response_status	(	tlm::TLM_INCOMPLETE_RESPONSE);
-	tObj.set_gp_option			(	tlm::TLM_MIN_PAYLOAD	); 
-	tObj.set_dmi_allowed		(	false					);
-	tObj.set_byte_enable_ptr	(	0						);
-	tObj.set_byte_enable_length (	0						);
-
-	if (gvoc_target_idx == 0)
+	gvoc_sched.copy_record		(	record, tObj.get_data_ptr(), tObj.get_data_length() );
+}
+
+
+//======================================================================
+/// @fn update_schedule
+//
+/// @brief checks whether datasets have to be sent to a target at the given time
+//
+/// @details
+///		When the active record of the schedule differs from the last record sent
+///		to the target, or when the refresh interval has expired since it was sent,
+///		the number of pending datasets is set to the datasets per process cycle
+///		of the target. <br>
+///		Without a usable schedule file, a dataset is always pending, so that
+///		the default record is written until the end of each quantum.
+//
+/// @retval true if a dataset is pending for the target
+//
+//======================================================================
+bool initiator_gvoc::update_schedule(	const sc_core::sc_time &now,
+										int &record,
+										sc_core::sc_time &sent,
+										unsigned int &pending,
+										unsigned int dataset_cycle)
+{
+	int idx = gvoc_sched.active(now);
+
+	if ( gvoc_continuous )
+	{
+		record	= idx;
+		sent	= now;
+		pending	= 1;
+		return true;
+	}
+	if ( idx >= 0 && ( idx != record || ( gvoc_refresh > sc_core::SC_ZERO_TIME && now - sent >= gvoc_refresh ) ) )
+	{
+		record	= idx;
+		sent	= now;
+		pending	= dataset_cycle;
+	}
+	return pending > 0;
+}
+
+
+//======================================================================
+/// @fn fit_in_quantum
+//
+/// @brief limits the pending datasets to those which fit in the current quantum
+//
+/// @details The duration of the last write is taken as the duration of the
+///		following ones. The datasets which would end after the quantum are 
+///		dropped, since the start address is reset at its end.
+//
+//======================================================================
+void initiator_gvoc::fit_in_quantum	(	const sc_core::sc_time &now,
+										const sc_core::sc_time &duration,
+										unsigned int &pending )
+{
+	unsigned int	fit;
+
+	if ( pending > 0 )
 	{
-		tObj.set_data_length	(	gvoc_monitor_data_length	);
-		tObj.set_streaming_width(	gvoc_monitor_data_length	);
+		pending--;
 	}
-	else if (gvoc_target_idx == 1) 
+	if ( gvoc_continuous || gvoc_quantum == sc_core::SC_ZERO_TIME || duration == sc_core::SC_ZERO_TIME )
 	{
-		tObj.set_data_length	(	gvoc_see_data_length		);
-		tObj.set_streaming_width(	gvoc_see_data_length		);
+		return;
 	}
+	fit		= (unsigned int)( time_to_quantum_end(now) / duration );
+	pending	= std::min( pending, fit );
+}
 
+
+//======================================================================
+/// @fn time_to_quantum_end
+//
+/// @brief returns the time from the given time to the end of its quantum
+//
+//======================================================================
+sc_core::sc_time initiator_gvoc::time_to_quantum_end( const sc_core::sc_time &now )
+{
+	if ( gvoc_quantum == sc_core::SC_ZERO_TIME )
+	{
+		return sc_core::sc_time(1, node_time_unit);
+	}
+	sc_core::sc_time rest = now % gvoc_quantum;
+	return gvoc_quantum - rest;
 }
 
 
@@ -303,8 +481,8 @@ void initiator_gvoc::set_trans_Obj(	tlm::tlm_generic_payload& tObj,
 //======================================================================
 /// @fn prepare_datablock
 //
-/// @brief converts to the data for the next transaction in string and store it in
-///		the memory block where #gvoc_data points to. 
+/// @brief converts the default g.v.o.c. data in string and adds it as record
+///		of the schedule, active from the start of the simulation.
 //
 ///	@details This is just an example. So the user should and can changed it according
 ///		its needs
@@ -314,5 +492,5 @@ void initiator_gvoc::prepare_datablock(void)
 {
 	datyp gvoc_databuf =	1;
 	std::string tmp = data_conversion::toString(gvoc_databuf);
-	std::memcpy( gvoc_data, tmp.data(), size_t(str_size) );
+	gvoc_sched.add( sc_core::SC_ZERO_TIME, (const datyp*)tmp.data(), (unsigned int)str_size );
 }
\ No newline at end of file
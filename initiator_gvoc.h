@@ -34,7 +34,9 @@
 ///			a proprioceptive Node
 //
 ///  @details It transfers the g.v.o.c. data to the self-expressive engine and the 
-///		the monitor of the node. <br>
+///		the monitor of the node. The data is taken from a time indexed schedule and
+///		only transferred when the active record of the schedule changes or when the
+///		refresh interval expires. <br>
 ///		Its Targets: Monitor and SEE through the IC3 component
 // 
 //==============================================================================
@@ -47,6 +49,8 @@
 #include <tlm_utils\tlm_quantumkeeper.h>
 
 #include "constants.h"
+#include "payload_pool.h"
+#include "gvoc_schedule.h"
 
 class initiator_gvoc :	public sc_module,
 						virtual public tlm::tlm_bw_transport_if<>{
@@ -60,6 +64,10 @@ public:
 				  , const unsigned int	see_nr_dataset_cycle						///< number of gvoc datasets pro cycle for the see component
 				  , const unsigned int	monitor_nr_dataset_cycle					///< number of gvoc datasets pro cycle for the monitor component
 				  , sc_core::sc_time	glob_quantum								///< time value for the global quantum
+				  , payload_pool&		pool										///< payload pool of the node
+				  , const char*			schedule_file								///< schedule file name, 0 for the default record of prepare_datablock()
+				  , sc_core::sc_time	refresh_interval							///< interval after which the active record is sent again, SC_ZERO_TIME to send it only on changes
+				  , process_mode		mode										///< PM_EXECUTOR: no own thread processes
 				  );
 
 	SC_HAS_PROCESS(initiator_gvoc);
@@ -67,6 +75,16 @@ public:
 // Method Declarations =========================================================
 	void gvoc_see_thread( void );													
 	void gvoc_monitor_thread( void );
+
+	void gvoc_monitor_transfer( void );
+
+	void gvoc_see_transfer( void );
+
+	/// quantum keeper of A1
+	tlm_utils::tlm_quantumkeeper& get_monitor_qk( void )	{ return gvoc_m_qk; }
+
+	/// quantum keeper of A2
+	tlm_utils::tlm_quantumkeeper& get_see_qk( void )		{ return gvoc_see_qk; }
 	
 	void execute_trans	( 	tlm::tlm_generic_payload& tObj, 						///< ref to transaction object
 							const unsigned int &target_id,							///< const ref to target component ID
@@ -75,9 +93,24 @@ public:
 
 	void set_trans_Obj	(	tlm::tlm_generic_payload& tObj,							///< ref to transaction object
 							const sc_dt::uint64 &adr,								///< cont ref to transaction start address
-							unsigned char* data										///< pointer to transaction data
+							int record												///< index of the schedule record to be sent
 						);
 
+	bool update_schedule	(	const sc_core::sc_time &now,						///< current time of the thread process
+								int &record,										///< ref to the index of the last record sent to the target
+								sc_core::sc_time &sent,								///< ref to the time of the last record sent to the target
+								unsigned int &pending,								///< ref to the number of datasets still to be sent
+								unsigned int dataset_cycle							///< number of datasets per process cycle for the target
+							);
+
+	void fit_in_quantum	(	const sc_core::sc_time &now,							///< current time of the thread process, after the last write
+							const sc_core::sc_time &duration,						///< duration of the last write
+							unsigned int &pending									///< ref to the number of datasets still to be sent
+						);
+
+	sc_core::sc_time time_to_quantum_end	(	const sc_core::sc_time &now			///< current time of the thread process
+											);
+
 //interface methods
 
 	void invalidate_direct_mem_ptr	(	sc_dt::uint64 start_range,  				///< start address of the memory range
@@ -98,13 +131,19 @@ public:
 private:
 	std::string						gvoc_name					;					///< sc module name
 	unsigned int					gvoc_id						;					///< component id
-	tlm::tlm_generic_payload		gvoc_tObj					;					///< transaction object
+	payload_pool&					gvoc_pool					;					///< payload pool of the node
+	unsigned int					gvoc_see_tmpl, gvoc_m_tmpl	;					///< template indexes of the write transactions to the SEE and to the Monitor in the pool
 	unsigned int					gvoc_see_data_length, gvoc_see_dataset_cycle	;	///< data length, number of dataset pro cycle to be send to the SEE component
 	unsigned int					gvoc_monitor_data_length, gvoc_m_dataset_cycle	;	///< data length, number of dataset pro cycle to be send to the Monitor component
 	sc_core::sc_time				gvoc_m_delay, gvoc_see_delay;					///< transaction time delays
 	sc_dt::uint64					gvoc_see_adr_start, gvoc_m_adr_start;			///< transaction start adresses
 	tlm_utils::tlm_quantumkeeper	gvoc_see_qk, gvoc_m_qk		;					///< quantum keeper
-	sc_dt::uchar*					gvoc_data					;					///< data pointer
+	gvoc_schedule					gvoc_sched					;					///< schedule of the g.v.o.c. data
+	sc_core::sc_time				gvoc_quantum, gvoc_refresh	;					///< global quantum, refresh interval
+	int								gvoc_m_record, gvoc_see_record	;				///< index of the last record sent to the Monitor and to the SEE
+	sc_core::sc_time				gvoc_m_sent, gvoc_see_sent	;					///< time of the last record sent to the Monitor and to the SEE
+	unsigned int					gvoc_m_pending, gvoc_see_pending;				///< number of datasets still to be sent to the Monitor and to the SEE
+	bool							gvoc_continuous				;					///< no usable schedule file: the default record is written until the end of each quantum
 	
 	void set_target_idx	(const unsigned int &id)				;					/// defines the target component of the transaction by setting #gvoc_target_idx				
 };
@@ -40,10 +40,12 @@ static const char			*filename = "initiator_othernode.cpp_B"	;	/// filename for r
 /// @brief constructor
 //
 /// @details 
-///		declares the thread process ( on_thread() ) of this component.
+///		declares the thread process ( on_thread() ) of this component, unless
+///		the node runs it in its executor thread.
 ///		<br>binds the initiator socket to the module. <br>
 ///		sets the global quantum and re-calculates the local quantum for
-///		temporal decoupling.	  
+///		temporal decoupling. <br>
+///		registers the template of its write transactions in the payload pool.
 //
 //================================================================================
 initiator_othernode::initiator_othernode	(	sc_module_name module_name						///< sc module name
@@ -51,6 +53,8 @@ initiator_othernode::initiator_othernode	(	sc_module_name module_name						///<
 											, 	unsigned int data_length						///< maximal length for sensor data
 											,	unsigned int nr_dataset_cycle					///< number of sensor datasets pro cycle
 											,	sc_core::sc_time	glob_quantum				///< time value for the global quantum
+											,	payload_pool&		pool						///< payload pool of the node
+											,	process_mode		mode						///< PM_EXECUTOR: no own thread process
 											):
 											  on_id				(	ID				)
 											, on_name			(	name()			)
@@ -58,11 +62,16 @@ initiator_othernode::initiator_othernode	(	sc_module_name module_name						///<
 											, on_dataset_cycle	(	nr_dataset_cycle)
 											, on_mem_adr_start	(	0				)
 											, on_isocket		(	"on_isocket"	)
+											, on_pool			(	pool			)
 											
 {
-	SC_THREAD( on_thread );
+	if ( mode != PM_EXECUTOR )
+	{
+		SC_THREAD( on_thread );
+	}
 
 	on_isocket.bind( *this );
+	on_tmpl = on_pool.add_template( tlm::TLM_WRITE_COMMAND, on_data_length );
 	on_qk.set_global_quantum ( glob_quantum );		
 	on_qk.reset();								
 }
@@ -74,50 +83,19 @@ initiator_othernode::initiator_othernode	(	sc_module_name module_name						///<
 /// @brief Thread process B of the process cycle of the Node.
 //
 /// @details
-///		It readouts data, which were sent from others nodes, from the fifo vector
-///		of this component and generate new transactions to send it to the SAE component. 
+///		It performs the transfers of B ( on_transfer() ) until the end of the
+///		quantum and synchronizes.
 //
-//	@see	initiator_gvoc::read_out_fifo()
-/// @see	initiator_gvoc::set_target_idx()
-///	@see	initiator_gvoc::set_trans_Obj()
-/// @see 	initiator_gvoc::execute_trans()
+/// @see	initiator_othernode::on_transfer()
 //======================================================================
 void initiator_othernode::on_thread(void)
 {
-	std::ostringstream  msg;
-	sc_core::sc_time	wait_time		=	sc_core::SC_ZERO_TIME;
-	sc_dt::uchar		data;
-
 	wait( 0.3, node_time_unit );
 	while( true )
 	{ 
-		on_delay						=	on_qk.get_local_time();		
-		
-		read_out_fifo();
-		if ( on_queue.empty() == false )
-		{
-			data = on_queue.front();
-		}
-		else 
-		{
-			msg<< "\t No Data available!";
-			ERROR_LOG(filename, __FUNCTION__ , msg.str());
-		}
-		on_data = &data; 
-		set_trans_Obj(	on_tObj, on_mem_adr_start, on_data);
-		execute_trans(	on_tObj );
-
-		if (on_dataset_cycle>1)
-		{
-			memset(on_data, 0, size_t(on_data_length)); 
-			on_mem_adr_start += on_data_length;
-		}
-
-		on_qk.set( on_delay );							// Update quantum keeper with time consumed by target
+		on_transfer();
 		if ( on_qk.need_sync() )						// Check local time against quantum and sync if neccessary
 		{
-			on_mem_adr_start = 0;
-
 			trtr::follow_synch(filename, on_name, "B", on_id, on_delay, trtr::S_NEED);
 			on_qk.sync();
 			trtr::follow_synch(filename, on_name, "B", on_id, on_delay, trtr::S_RETURN);
@@ -127,6 +105,53 @@ void initiator_othernode::on_thread(void)
 }
 
 
+//======================================================================
+/// @fn on_transfer
+//
+/// @brief transfer of process B, common to its thread and the executor of the node.
+//
+/// @details
+///		It readouts the messages, which were sent from others nodes, from the message
+///		fifo of this component and generate new transactions to send each of them to the
+///		SAE component. A message is read directly into the pooled data buffer of the
+///		transaction object. After the last transfer of a quantum, the start address
+///		is reset.
+//
+//	@see	initiator_othernode::read_out_fifo()
+///	@see	initiator_othernode::set_trans_Obj()
+/// @see 	initiator_othernode::execute_trans()
+//======================================================================
+void initiator_othernode::on_transfer(void)
+{
+	std::ostringstream  msg;
+	tlm::tlm_generic_payload	*tObj;
+
+	on_delay						=	on_qk.get_local_time();		
+	
+	tObj = on_pool.allocate( on_tmpl );
+	if ( !read_out_fifo( tObj->get_data_ptr() ) )
+	{
+		msg.str("");
+		msg<< "\t No Data available!";
+		ERROR_LOG(filename, __FUNCTION__ , msg.str());
+	}
+	set_trans_Obj(	*tObj, on_mem_adr_start );
+	execute_trans(	*tObj );
+	tObj->release();
+
+	if (on_dataset_cycle>1)
+	{
+		on_mem_adr_start += on_data_length;
+	}
+
+	on_qk.set( on_delay );							// Update quantum keeper with time consumed by target
+	if ( on_qk.need_sync() )
+	{
+		on_mem_adr_start = 0;
+	}
+}
+
+
 //======================================================================
 /// @fn execute_trans
 //
@@ -169,43 +194,42 @@ tlm::tlm_sync_enum initiator_othernode::nb_transport_bw 	( 	tlm::tlm_generic_pay
 //======================================================================
 /// @fn set_trans_Obj
 //
-/// @brief uses the given parameters to build a new transaction object for
-///		each transaction 
+/// @brief uses the given parameters to complete a transaction object of 
+///		the pool for each transaction 
+//
+/// @details
+///		All the other attributes are already set by the template of the pool
+///		and the data is already in the pooled data buffer.
 //
 //======================================================================
 void initiator_othernode::set_trans_Obj(	tlm::tlm_generic_payload& tObj,
-											const sc_dt::uint64 &adr,
-											unsigned char* data)
+											const sc_dt::uint64 &adr)
 {
-	tObj.set_command			( tlm::TLM_WRITE_COMMAND		);
 	tObj.set_address			( adr							);
-	tObj.set_data_length		( on_data_length				);
-	tObj.set_data_ptr			( data							);
-	tObj.set_streaming_width	( on_data_length				);
-	tObj.set_response_status	( tlm::TLM_INCOMPLETE_RESPONSE	);
-	tObj.set_gp_option			( tlm::TLM_MIN_PAYLOAD			); 
-	tObj.set_dmi_allowed		( false							);
-	tObj.set_byte_enable_ptr	( 0								);
-	tObj.set_byte_enable_length ( 0								);
 }
 
 
 //======================================================================
 /// @fn read_out_fifo
 //
-/// @brief It reads out the available dataset from the fifo channel to which the input port 
-///			of this component is bounded and pushed them one by one in a vector. <br>
-///			This is performed by every execution of Process D to always make empty slots available 
-///			for other nodes to write in and thus ensure an asynchron communication
+/// @brief It reads out the next message from the message fifo to which the input port 
+///			of this component is bounded into the given buffer. <br>
+///			This is performed by every transaction of Process B to always make empty slots 
+///			available for other nodes to write in and thus ensure an asynchron communication
 ///			between the nodes.
 //
-/// @details just an example
+/// @details The message is truncated or zero padded to #on_data_length bytes.
+///			Without message, the buffer is zeroed.
+//
+/// @retval false if no message was available
 //
 //======================================================================
-void initiator_othernode::read_out_fifo()
+bool initiator_othernode::read_out_fifo( unsigned char* dataset )
 {
-	while ( on_data_inport->num_available() >0 )
+	if ( on_data_inport->nb_read_msgs( dataset, 1, on_data_length ) == 0 )
 	{
-		on_queue.push(	on_data_inport->read()	);
-	} 
+		memset( dataset, 0, size_t(on_data_length) );
+		return false;
+	}
+	return true;
 }
\ No newline at end of file
@@ -47,9 +47,10 @@
 #include <systemc.h>
 #include "tlm.h"																// TLM headers
 #include <tlm_utils\tlm_quantumkeeper.h>
-#include <queue>
 
 #include "constants.h"
+#include "payload_pool.h"
+#include "message_fifo.h"
 
 class initiator_othernode:	public sc_module, 
 							virtual public tlm::tlm_bw_transport_if<>{
@@ -61,6 +62,8 @@ public:
 							, 	unsigned int data_length						///< maximal length for sensor data
 							,	unsigned int nr_dataset_cycle					///< number of sensor datasets pro cycle
 							,	sc_core::sc_time	glob_quantum				///< time value for the global quantum
+							,	payload_pool&		pool						///< payload pool of the node
+							,	process_mode		mode						///< PM_EXECUTOR: no own thread process
 						);
 
 	SC_HAS_PROCESS(initiator_othernode);
@@ -68,9 +71,13 @@ public:
 // Methods declarations
 	void on_thread(void);
 
+	void on_transfer(void);
+
+	/// quantum keeper of the process
+	tlm_utils::tlm_quantumkeeper& get_qk(void)	{ return on_qk; }
+
 	void set_trans_Obj	(	tlm::tlm_generic_payload& tObj,						///< ref transaction object
-							const sc_dt::uint64 &adr,							///< const ref to transaction data
-							unsigned char* data									///< pointer to the transaction data
+							const sc_dt::uint64 &adr							///< const ref to transaction address
 						);
 
 	void initiator_othernode::execute_trans	(  tlm::tlm_generic_payload& tObj	///< ref transaction object
@@ -85,24 +92,24 @@ public:
 											tlm::tlm_phase& phase, 				///< ref to transaction phase
 											sc_core::sc_time& delay 			///< ref to time delay
 										);
-	void read_out_fifo();
+	bool read_out_fifo	(	unsigned char* dataset								///< pointer to a buffer of on_data_length bytes
+						);
 
 
 // Variable and Object Declarations ============================================
 	tlm::tlm_initiator_socket<buswidth1>						on_isocket;		///< initiator socket for communication with ic1
-	sc_core::sc_port< sc_fifo_in_if<sc_dt::uchar> >				on_data_inport;	///< input port for incoming data from other nodes.
+	sc_core::sc_port< message_fifo_in_if >						on_data_inport;	///< input port for incoming messages from other nodes.
 
 private:
 
 	unsigned int					on_id				;						///< component id
 	std::string 					on_name				;						///< component name
-	tlm::tlm_generic_payload		on_tObj				;						///<transaction object
+	payload_pool&					on_pool				;						///< payload pool of the node
+	unsigned int					on_tmpl				;						///< template index of the write transactions in the pool
 	unsigned int					on_data_length, on_dataset_cycle;			///< transaction data length, number of dataset pro cycle which will be sent to the SAE
 	sc_core::sc_time				on_delay			;						///< transaction delay
 	sc_dt::uint64					on_mem_adr_start; //on_mem_adr_end;			///< transaction start address
-	sc_dt::uchar					*on_data			;						///< data pointer
 	tlm_utils::tlm_quantumkeeper	on_qk				;						///< quantum keeper
-	std::queue< sc_dt::uchar, std::deque<sc_dt::uchar> > on_queue;				///< data container
 }; 
 
 #endif /* __INITIATOR_OTHERNODE_H__ */
\ No newline at end of file
@@ -43,11 +43,13 @@ static const char			*suffix		= "data_output.m";
 /// @brief constructor
 //
 /// @details
-///		declares the thread process ( sensor_thread() ) of this component.
+///		declares the thread process ( sensor_thread() ) of this component, unless
+///		the node runs it in its executor thread.
 ///		<br> binds the initiator socket to the module. <br>
 ///		<br> initializes some data block
 ///		sets the global quantum and re-calculates the local quantum for
 ///		temporal decoupling.
+///		<br> registers the template of its write transactions in the payload pool.
 //
 //======================================================================
 initiator_sensorenv::initiator_sensorenv(	sc_module_name		module_name							///< sc module name
@@ -56,6 +58,8 @@ initiator_sensorenv::initiator_sensorenv(	sc_module_name		module_name							///<
 										,	unsigned int		nr_dataset_cycle					///< number of sensor datasets pro cycle
 										,	sc_core::sc_time	glob_quantum						///< time value for the global quantum
 										,	unsigned int		fifo_size							///< size of the fifo channel bound to its input port
+										,	payload_pool&		pool								///< payload pool of the node
+										,	process_mode		mode								///< PM_EXECUTOR: no own thread process
 										)
 										: 
 										  s_name			(  name()				)
@@ -66,11 +70,16 @@ initiator_sensorenv::initiator_sensorenv(	sc_module_name		module_name							///<
 										, s_dataset_cycle	(  nr_dataset_cycle		)
 										, s_delay			(  sc_core::sc_time( 0, node_time_unit ) )
 										, s_fifo_size		(	fifo_size)
+										, s_pool			(	pool	)
 {
-	SC_THREAD(sensor_thread);
+	if ( mode != PM_EXECUTOR )
+	{
+		SC_THREAD(sensor_thread);
+	}
 	s_qk.set_global_quantum ( glob_quantum );	
 	s_qk.reset();								
 	s_isocket.bind(*this);
+	s_tmpl = s_pool.add_template( tlm::TLM_WRITE_COMMAND, s_data_length );
 
 	if ( (s_fifo_size/s_dataset_cycle) < 1 )
 		ERROR_LOG( filename, __FUNCTION__ , "Number of Data block per cycle is bigger than the fifo_size!!!");
@@ -83,35 +92,20 @@ initiator_sensorenv::initiator_sensorenv(	sc_module_name		module_name							///<
 //
 /// @brief Thread process B of the process cycle of the Node.
 //
-/// @details  It generates new data, sets new transactions objects to  
-///		perform each transaction or write operation on the SAE Memory.
+/// @details  It performs the transfers of B ( sensor_transfer() ) until the end of
+///		the quantum and synchronizes.
 //
-///	@see 	initiator_sensorenv::set_trans_Obj()
-/// @see 	initiator_sensorenv::execute_trans(tlm::tlm_generic_payload& tObj)
+///	@see 	initiator_sensorenv::sensor_transfer()
 //
 //======================================================================
 void initiator_sensorenv::sensor_thread(void)
 {
-	sc_core::sc_time	wait_time	=	sc_core::SC_ZERO_TIME;
-
 	wait( 0.2, node_time_unit );
 	while( true )
 	{ 
-		s_delay				=	s_qk.get_local_time();				// Annotate b_transport with local time	
-		read_out_fifo();											// daten aus dem FiFO lesen
-		set_trans_Obj	(	s_tObj, s_mem_adr_start, &senv_data	);
-		execute_trans	(	s_tObj	);		
-
-		if (s_dataset_cycle>1)
-		{
-			s_mem_adr_start += s_data_length;					
-		}
-		memset(&senv_data, 0, size_t(s_data_length));
-
-		s_qk.set( s_delay );										// Update quantum keeper with time consumed by target
+		sensor_transfer();
 		if ( s_qk.need_sync() )										// Check local time against quantum and sync if neccessary
 		{
-			s_mem_adr_start = 0;
 			trtr::follow_synch(filename, s_name, "B", s_id, s_delay, trtr::S_NEED);
 			s_qk.sync();
 			trtr::follow_synch(filename, s_name, "B", s_id, s_delay, trtr::S_RETURN);
@@ -120,6 +114,46 @@ void initiator_sensorenv::sensor_thread(void)
 	}
 };
 
+//======================================================================
+/// @fn sensor_transfer
+//
+/// @brief transfer of process B, common to its thread and the executor of the node.
+//
+/// @details  It generates new data, sets new transactions objects to  
+///		perform each transaction or write operation on the SAE Memory.
+///		Each transaction object is taken from the payload pool of the node
+///		and released after the call. The dataset is read from the fifo 
+///		directly into the pooled data buffer of the transaction object.
+///		After the last transfer of a quantum, the start address is reset.
+//
+///	@see 	initiator_sensorenv::set_trans_Obj()
+/// @see 	initiator_sensorenv::execute_trans(tlm::tlm_generic_payload& tObj)
+//
+//======================================================================
+void initiator_sensorenv::sensor_transfer(void)
+{
+	tlm::tlm_generic_payload	*tObj;
+
+	s_delay				=	s_qk.get_local_time();				// Annotate b_transport with local time	
+	tObj			=	s_pool.allocate( s_tmpl );
+	read_out_fifo	(	tObj->get_data_ptr()	);				// daten aus dem FiFO lesen
+	set_trans_Obj	(	*tObj, s_mem_adr_start	);
+	execute_trans	(	*tObj	);		
+	tObj->release();
+
+	if (s_dataset_cycle>1)
+	{
+		s_mem_adr_start += s_data_length;					
+	}
+
+	s_qk.set( s_delay );										// Update quantum keeper with time consumed by target
+	if ( s_qk.need_sync() )
+	{
+		s_mem_adr_start = 0;
+	}
+}
+
+
 //======================================================================
 /// @fn execute_trans
 //
@@ -177,24 +211,18 @@ tlm::tlm_sync_enum initiator_sensorenv::nb_transport_bw(tlm::tlm_generic_payload
 //======================================================================
 /// @fn set_trans_Obj
 //
-/// @brief uses the given parameters to build a new transaction object for
-///		the next transaction 
+/// @brief uses the given parameters to complete a transaction object of 
+///		the pool for the next transaction 
+//
+/// @details
+///		All the other attributes are already set by the template of the pool
+///		and the data is already in the pooled data buffer.
 //
 //======================================================================
 void initiator_sensorenv::set_trans_Obj(tlm::tlm_generic_payload& tObj,
-										const sc_dt::uint64 &adr,
-										unsigned char* data)
+										const sc_dt::uint64 &adr)
 {
-	tObj.set_command			( tlm::TLM_WRITE_COMMAND		);
 	tObj.set_address			( adr							);
-	tObj.set_data_length		( s_data_length					);
-	tObj.set_data_ptr			( data							);
-	tObj.set_streaming_width	( s_data_length					);
-	tObj.set_response_status	( tlm::TLM_INCOMPLETE_RESPONSE	);
-	tObj.set_gp_option			( tlm::TLM_MIN_PAYLOAD			); 
-	tObj.set_dmi_allowed		( false							);
-	tObj.set_byte_enable_ptr	( 0								);
-	tObj.set_byte_enable_length ( 0								);
 }
 
 
@@ -202,9 +230,14 @@ void initiator_sensorenv::set_trans_Obj(tlm::tlm_generic_payload& tObj,
 //======================================================================
 /// @fn read_out_fifo
 //
-/// @brief reads a dataset from the fifo channel linked to the input port
-///			of this component and stores it in the private class
-///			variable #senv_data
+/// @brief reads a complete dataset of #s_data_length bytes from the fifo 
+///			channel linked to the input port of this component into the
+///			given buffer.
+//
+/// @details The dataset is only read if it is completely available, so
+///			that the following datasets stay aligned. Otherwise the buffer
+///			is zeroed and the data stays in the fifo for the next transaction.
+///			The dataset is read with a single bulk read.
 //
 /// @attention The port and fifo channel have the data type datyp, which is 
 ///			 unsigned char. This is why data type conversion isn't performed 
@@ -213,10 +246,12 @@ void initiator_sensorenv::set_trans_Obj(tlm::tlm_generic_payload& tObj,
 ///			the readout and before every transaction.
 //
 //======================================================================
-void initiator_sensorenv::read_out_fifo()
+void initiator_sensorenv::read_out_fifo( unsigned char* dataset )
 {
-	while ( senv_data_inport->num_available() >0 )
+	if ( senv_data_inport->num_available() < int(s_data_length) )
 	{
-		senv_data = 	senv_data_inport->read();
-	} 
+		memset( dataset, 0, size_t(s_data_length) );
+		return;
+	}
+	senv_data_inport->nb_read_n( dataset, int(s_data_length) );
 }
\ No newline at end of file
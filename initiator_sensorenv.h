@@ -50,6 +50,8 @@
 #include <queue>
 
 #include "constants.h"
+#include "payload_pool.h"
+#include "block_fifo.h"
 
 class initiator_sensorenv:	public sc_module, 
 							virtual public tlm::tlm_bw_transport_if<>{
@@ -62,6 +64,8 @@ public:
 						,	unsigned int		nr_dataset_cycle					///< number of sensor datasets pro cycle
 						,	sc_core::sc_time	glob_quantum						///< time value for the global quantum
 						,	unsigned int		fifo_size							///< size of the fifo channel bound to its input port
+						,	payload_pool&		pool								///< payload pool of the node
+						,	process_mode		mode								///< PM_EXECUTOR: no own thread process
 						);
 
 	/// 
@@ -70,13 +74,17 @@ public:
 
 // Method Declarations =========================================================
 	void sensor_thread	( void );
+
+	void sensor_transfer	( void );
+
+	/// quantum keeper of the process
+	tlm_utils::tlm_quantumkeeper& get_qk	( void )	{ return s_qk; }
 	
 	void execute_trans	(	tlm::tlm_generic_payload& tObj						///< ref transaction object
 						);
 		
 	void set_trans_Obj	(	tlm::tlm_generic_payload& tObj,						///< ref transaction object
-							const sc_dt::uint64 &adr,							///< const ref to transaction data
-							unsigned char* data									///< pointer to transation data
+							const sc_dt::uint64 &adr							///< const ref to transaction address
 						);
 	
 // interface methods
@@ -92,22 +100,23 @@ public:
 									
 	//void prepare_datablock(void);
 	
-	void read_out_fifo();
+	void read_out_fifo	(	unsigned char* dataset								///< pointer to a buffer of s_data_length bytes
+						);
 
 // Variable and Object Declarations ============================================
 	tlm::tlm_initiator_socket<buswidth1>			s_isocket		;			///< initiator socket for communication with IC1
-	sc_core::sc_port< sc_fifo_in_if	<datyp>	>		senv_data_inport;			///< input port bounded to the fifo channel in the parent module termed node
+	sc_core::sc_port< block_fifo_in_if <datyp> >	senv_data_inport;			///< input port bounded to the block fifo channel in the parent module termed node
 	
 
 private:
 	int								s_id					;					///< component id
 	std::string						s_name					;					///< component name
-	tlm::tlm_generic_payload		s_tObj					;					///< transaction object
+	payload_pool&					s_pool					;					///< payload pool of the node
+	unsigned int					s_tmpl					;					///< template index of the write transactions in the pool
 	unsigned int					s_data_length, s_dataset_cycle;				///< transaction data llength, number of dataset pro cycle which will be sent to the SAE component
 	sc_core::sc_time				s_delay					;					///< transaction time delay
 	sc_dt::uint64					s_mem_adr_start			;					///< transaction start address
 	tlm_utils::tlm_quantumkeeper	s_qk					;					///< quantum keeper
-	sc_dt::uchar					senv_data				;					///< data pointer
 	unsigned int 					s_fifo_size				;					///< fifo size
 	std::queue< sc_dt::uchar, std::deque<sc_dt::uchar> > senv_queue;				///< data container
 	std::string						senv_dataoutput_file	;
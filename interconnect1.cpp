@@ -28,8 +28,11 @@
 */
 
 #define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <algorithm>
+
 #include "interconnect1.h"
 #include "constants.h"
+#include "reporting.h"
 
 static const char *filename = "interconnect1.cpp"; ///< filename for reporting
 
@@ -42,6 +45,9 @@ static const char *filename = "interconnect1.cpp"; ///< filename for reporting
 /// @details It initializes the vector of target sockets with the specified number of
 ///		target sockets which is equals to the number of its initiators (SenEnv and OtherNode).
 ///		<br> It binds each of them to the module and registers the callbacks for their use.
+///		<br> In the coalescing mode, it also allocates the staging copy of the sae memory
+///		and declares the method process which commits the staged writes.
+///		<br> Finally it initializes the traffic statistics of each socket.
 //
 //
 //=======================================================================
@@ -49,10 +55,18 @@ static const char *filename = "interconnect1.cpp"; ///< filename for reporting
 interconnect1::interconnect1 ( sc_module_name name 																	///< sc module name
 							, const unsigned int tsocket_number														///< number of target sockets
 							, const unsigned int sae_memory_size_													///< memory size of the sae component 
+							, const unsigned int sae_memory_width_													///< memory width of the sae component (bytes)
+							, const sc_core::sc_time sae_write_latency_												///< write response delay of the sae component
+							, const bool coalescing_																///< enables the write coalescing mode
+							, const sc_core::sc_time glob_quantum													///< time value for the global quantum
 							): 
 							  ic1_isocket		("isocket")															///< initiator socket name
 							, ic1_tsocket_nr	(tsocket_number)													///< number of initiators
 							, sae_memory_size	(sae_memory_size_)
+							, sae_memory_width	(sae_memory_width_)
+							, sae_write_latency	(sae_write_latency_)
+							, ic1_coalescing	(coalescing_)
+							, ic1_stage			(0)
 {
 	ic1_isocket.register_invalidate_direct_mem_ptr		( this, &interconnect1::invalidate_direct_mem_ptr	);	
 	ic1_isocket.register_nb_transport_bw				( this, &interconnect1::nb_transport_bw				);
@@ -65,6 +79,23 @@ interconnect1::interconnect1 ( sc_module_name name 																	///< sc modu
 		ic1_tsocket_array[i].register_nb_transport_fw	( this, &interconnect1::nb_transport_fw		, i);
 		ic1_tsocket_array[i].register_transport_dbg		( this, &interconnect1::transport_dbg		, i);
 	}
+
+	if ( ic1_coalescing )
+	{
+		ic1_stage = new unsigned char[size_t(sae_memory_size)];
+		memset( ic1_stage, 0, size_t(sae_memory_size) );
+
+		SC_METHOD( commit_method );
+		sensitive << commit_ev;
+		dont_initialize();
+	}
+
+	ic1_stats.resize(ic1_tsocket_nr + 1);
+	for (unsigned int i = 0; i < ic1_tsocket_nr; i++)
+	{
+		ic1_stats[i].init( ic1_tsocket_array[i].basename(), glob_quantum );
+	}
+	ic1_stats[ic1_tsocket_nr].init( ic1_isocket.basename(), glob_quantum );
 }
 
 //=======================================================================
@@ -104,7 +135,11 @@ tlm::tlm_sync_enum interconnect1::nb_transport_bw ( tlm::tlm_generic_payload& tO
 /// @brief forwards the b_transport method call from the sae initiators to  
 /// sae component after the address mapping
 //
+/// @details In the coalescing mode, write calls are staged instead of being 
+///		forwarded. Any other call first commits the pending writes.
+//
 /// @see address_mapping(int id,tlm::tlm_generic_payload& tObj, bool direction)
+/// @see stage_write(tlm::tlm_generic_payload& tObj, sc_core::sc_time& delay)
 //
 //=======================================================================
 
@@ -114,8 +149,23 @@ void interconnect1::b_transport (	int id,
 {
 	std::ostringstream   msg;
 	msg.str ("");
+	sc_core::sc_time	delay_before	= delay;
+
 	address_mapping(id, tObj, true);
-	ic1_isocket->b_transport(tObj, delay);
+	if ( ic1_coalescing && (tObj.get_command() == tlm::TLM_WRITE_COMMAND) )
+	{
+		stage_write(tObj, delay);
+	}
+	else
+	{
+		if ( ic1_coalescing )
+		{
+			commit_method();
+		}
+		ic1_isocket->b_transport(tObj, delay);
+		ic1_stats[ic1_tsocket_nr].record( tObj.get_data_length(), delay_before, delay );
+	}
+	ic1_stats[id].record( tObj.get_data_length(), delay_before, delay );
 }
  
 
@@ -148,11 +198,64 @@ tlm::tlm_sync_enum interconnect1::nb_transport_fw ( int id,
 }
 	
 
+//=======================================================================
+/// @fn transport_dbg
+//
+/// @brief forwards the transport_dbg method call from the sae initiators 
+/// 	to the sae component after the address mapping
+//
+/// @details The address is restored after the call, so that the caller
+///		can reuse the transaction object. <br>
+///		In the coalescing mode, a debug read is served by the sae memory and
+///		then overlaid with the staged, not yet committed writes; a debug 
+///		write is applied to both the sae memory and the staging copy.
+//
+/// @see address_mapping(int id,tlm::tlm_generic_payload& tObj, bool direction)
+//
+//=======================================================================
 unsigned int interconnect1::transport_dbg(	int id,
 											tlm::tlm_generic_payload& tObj )
 {
+	sc_dt::uint64	adr		= tObj.get_address();
+	sc_dt::uint64	mapped_adr;
+	unsigned int	length	= tObj.get_data_length();
+	unsigned int	nbytes	= 0;
+
 	address_mapping(id, tObj, true);
-	return ic1_isocket->transport_dbg( tObj );	
+	mapped_adr = tObj.get_address();
+
+	if ( ic1_coalescing && (mapped_adr < sae_memory_size) )
+	{
+		if ( (mapped_adr + length) > sae_memory_size )
+			length = (unsigned int)(sae_memory_size - mapped_adr);
+
+		switch ( tObj.get_command() )
+		{
+		case tlm::TLM_READ_COMMAND:
+			nbytes = ic1_isocket->transport_dbg( tObj );
+			for ( size_t i = 0; i < stage_ranges.size(); i++ )
+			{
+				sc_dt::uint64 start	= std::max( stage_ranges[i].first, mapped_adr );
+				sc_dt::uint64 end	= std::min( stage_ranges[i].second, mapped_adr + nbytes );
+				if ( start < end )
+					memcpy( tObj.get_data_ptr() + (start - mapped_adr), ic1_stage + start, size_t(end - start) );
+			}
+			break;
+		case tlm::TLM_WRITE_COMMAND:
+			memcpy( ic1_stage+mapped_adr, tObj.get_data_ptr(), size_t(length) );
+			nbytes = ic1_isocket->transport_dbg( tObj );
+			break;
+		default:
+			break;
+		}
+	}
+	else
+	{
+		nbytes = ic1_isocket->transport_dbg( tObj );
+	}
+
+	tObj.set_address(adr);
+	return nbytes;
 }
 
 
@@ -201,4 +304,169 @@ void interconnect1::address_mapping(	int idx,
 		break;
 	}
 	tObj.set_address(mapped_adr);
+}
+
+
+//=======================================================================
+/// @fn stage_write
+//
+/// @brief copies the data of a mapped write call into the staging copy of  
+/// 	the sae memory instead of forwarding it.
+//
+/// @details
+///		The checks and the annotated delay are the same as those of 
+///		memory::operation() on the sae memory, so that the initiators see
+///		the same response and the same total latency as in the routed mode.
+///		The first staged write of an evaluation phase notifies #commit_ev for
+///		the next delta cycle. Since each initiator posts all datasets of a 
+///		quantum within one activation, all of them are committed together.
+///		Only the address ranges actually written are recorded for the commit.
+//
+/// @see memory::operation()
+//
+//=======================================================================
+
+void interconnect1::stage_write	(	tlm::tlm_generic_payload& tObj,
+									sc_core::sc_time& delay				)
+{
+	sc_dt::uint64	adr				= tObj.get_address();
+	unsigned int	length			= tObj.get_data_length();
+	unsigned int	burst_length	= (unsigned int)(ceil((double)length/sae_memory_width));
+
+	if ( tObj.get_byte_enable_ptr() )
+	{
+		tObj.set_response_status(tlm::TLM_BYTE_ENABLE_ERROR_RESPONSE);
+		delay = sc_core::SC_ZERO_TIME;
+		return;
+	}
+	else if ( tObj.get_streaming_width() != length ) 
+	{
+		tObj.set_response_status(tlm::TLM_BURST_ERROR_RESPONSE);
+		delay = sc_core::SC_ZERO_TIME;
+		return;
+	}
+
+	delay = delay + sae_write_latency*burst_length;
+	if ( (adr >= sae_memory_size) || ((adr + length) > sae_memory_size) )
+	{
+		tObj.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+		return;
+	}
+
+	memcpy( ic1_stage+adr, tObj.get_data_ptr(), size_t(length) );
+	if ( stage_ranges.empty() )
+	{
+		commit_ev.notify(sc_core::SC_ZERO_TIME);
+	}
+	add_stage_range( adr, adr + length );
+	tObj.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+
+//=======================================================================
+/// @fn add_stage_range
+//
+/// @brief adds the address range of a staged write to #stage_ranges
+//
+/// @details The ranges are kept sorted; a range overlapping or adjoining 
+///		other ones is merged with them. Since the datasets of an initiator 
+///		are written one after the other, there is usually one range per
+///		initiator, or a single one when all initiators have written.
+//
+//=======================================================================
+
+void interconnect1::add_stage_range	(	sc_dt::uint64 start,
+										sc_dt::uint64 end		)
+{
+	size_t	i	= 0;
+	size_t	j;
+
+	if ( end <= start )
+		return;
+
+	while ( i < stage_ranges.size() && stage_ranges[i].second < start )
+	{
+		i++;
+	}
+	j = i;
+	while ( j < stage_ranges.size() && stage_ranges[j].first <= end )
+	{
+		start	= std::min( start, stage_ranges[j].first );
+		end		= std::max( end, stage_ranges[j].second );
+		j++;
+	}
+	stage_ranges.erase( stage_ranges.begin() + i, stage_ranges.begin() + j );
+	stage_ranges.insert( stage_ranges.begin() + i, std::make_pair(start, end) );
+}
+
+
+//=======================================================================
+/// @fn commit_method
+//
+/// @brief method process which commits the staged writes to the sae 
+/// 	memory, one burst transaction per staged address range.
+//
+/// @details
+///		Only the bytes written by the initiators are committed: the gaps
+///		between the ranges are never written from the staging copy, which 
+///		doesn't follow the writes reaching the sae by other paths, e.g. its
+///		debug transport. The latency of the bursts isn't annotated to anyone,
+///		since it was already annotated to the initiators by stage_write().
+//
+//=======================================================================
+
+void interconnect1::commit_method( void )
+{
+	std::ostringstream	msg;
+	sc_core::sc_time	commit_delay;
+	sc_dt::uint64		start;
+	unsigned int		length;
+
+	if ( stage_ranges.empty() )
+		return;
+
+	commit_ev.cancel();
+	for ( size_t i = 0; i < stage_ranges.size(); i++ )
+	{
+		start			= stage_ranges[i].first;
+		length			= (unsigned int)(stage_ranges[i].second - start);
+		commit_delay	= sc_core::SC_ZERO_TIME;
+
+		commit_tObj.set_command				( tlm::TLM_WRITE_COMMAND		);
+		commit_tObj.set_address				( start							);
+		commit_tObj.set_data_ptr			( ic1_stage + start				);
+		commit_tObj.set_data_length			( length						);
+		commit_tObj.set_streaming_width		( length						);
+		commit_tObj.set_response_status		( tlm::TLM_INCOMPLETE_RESPONSE	);
+		commit_tObj.set_gp_option			( tlm::TLM_MIN_PAYLOAD			);
+		commit_tObj.set_dmi_allowed			( false							);
+		commit_tObj.set_byte_enable_ptr		( 0								);
+		commit_tObj.set_byte_enable_length	( 0								);
+
+		ic1_isocket->b_transport(commit_tObj, commit_delay);
+		ic1_stats[ic1_tsocket_nr].record( length, sc_core::SC_ZERO_TIME, commit_delay );
+
+		if ( !commit_tObj.is_response_ok() )
+		{
+			msg.str("");
+			msg << "\t IC1: commit of " << length << " staged bytes failed: "
+				<< commit_tObj.get_response_string();
+			ERROR_LOG(filename, __FUNCTION__ , msg.str());
+		}
+	}
+	stage_ranges.clear();
+}
+
+
+//=======================================================================
+/// @fn end_of_simulation
+//
+/// @brief writes the traffic statistics of the sockets of IC1
+//
+/// @see write_stats_file()
+//
+//=======================================================================
+void interconnect1::end_of_simulation ( void )
+{
+	write_stats_file( name(), ic1_stats );
 }
\ No newline at end of file
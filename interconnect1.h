@@ -36,7 +36,11 @@
 ///		It forwards the methods calls between all the initiators senenv, othernode and 
 ///		their target sae. <br>
 ///		It adjusts the address parameter of the transaction object before forwarding each call.
-///		to prevent the sensors for overwriting one another's data.
+///		to prevent the sensors for overwriting one another's data. <br>
+///		In the optional coalescing mode, the write calls of the initiators are not forwarded 
+///		one by one but staged in a copy of the sae memory and committed to the sae 
+///		once all the initiators have posted their datasets, as one burst transaction per 
+///		written address range.
 ///		
 //
 //==============================================================================
@@ -51,6 +55,7 @@
 #include <tlm_utils\multi_passthrough_target_socket.h>
 
 #include "constants.h"
+#include "socket_stats.h"
 
 class interconnect1 :	public sc_module
 {
@@ -59,8 +64,14 @@ public:
 	interconnect1	( sc_module_name name 													///< sc module name
 					, const unsigned int tsocket_number										///< number of target sockets
 					, const unsigned int sae_memory_size_									///< memory size of the sae component
+					, const unsigned int sae_memory_width_									///< memory width of the sae component (bytes)
+					, const sc_core::sc_time sae_write_latency_								///< write response delay of the sae component
+					, const bool coalescing_												///< enables the write coalescing mode
+					, const sc_core::sc_time glob_quantum									///< time value for the global quantum
 					);
 
+	SC_HAS_PROCESS(interconnect1);
+
 // Method Declarations =========================================================
 	//interface methods backward path
 	void invalidate_direct_mem_ptr	( 	sc_dt::uint64 start_range,  						///< start address of the memory range
@@ -91,7 +102,6 @@ public:
 											sc_core::sc_time& delay 						///< ref to delay time
 										);
 										
-	/// Required and unused interface method
 	unsigned int transport_dbg	( 	int id,													///< ID of the tagged target socket receiving the call 
 									tlm::tlm_generic_payload& tObj 							///< ref to transaction object
 								);
@@ -101,6 +111,22 @@ public:
 							bool direction													///< used communication path (forward or backward)
 						);
 
+	/// Stages a write call of an initiator in the coalescing mode
+	void stage_write(	tlm::tlm_generic_payload& tObj,							///< ref to transaction object
+						sc_core::sc_time& delay									///< ref to delay time
+					);
+
+	/// Adds the address range of a staged write to #stage_ranges
+	void add_stage_range(	sc_dt::uint64 start,								///< first staged address
+							sc_dt::uint64 end									///< address after the last staged byte
+						);
+
+	/// Commits the staged writes to the sae, one burst transaction per staged address range
+	void commit_method(void);
+
+	/// writes the socket statistics at the end of the simulation
+	void end_of_simulation(void);
+
 // Variable and Object Declarations ============================================
 	tlm_utils::simple_initiator_socket<interconnect1, buswidth1>		ic1_isocket;		///< simple initiator socket for communication with sae
 	sc_core::sc_vector<tlm_utils::simple_target_socket_tagged<interconnect1, buswidth1>> ic1_tsocket_array;	///< vector of tagged simple target sockets for communication with the sensors
@@ -108,5 +134,16 @@ public:
 private:
 	unsigned int				ic1_tsocket_nr;
 	const unsigned int			sae_memory_size;
+	const unsigned int			sae_memory_width;											///< width of the sae memory for the burst length calculation
+	const sc_core::sc_time		sae_write_latency;											///< latency annotated per burst for a staged write
+
+	//write coalescing
+	const bool					ic1_coalescing;												///< true, if the writes are coalesced before being forwarded
+	unsigned char				*ic1_stage;													///< staging copy of the sae memory
+	std::vector< std::pair<sc_dt::uint64, sc_dt::uint64> >	stage_ranges;					///< sorted, disjoint address ranges [start, end) of the staged and not yet committed writes
+	sc_core::sc_event			commit_ev;													///< notified after the first staged write of a quantum
+	tlm::tlm_generic_payload	commit_tObj;												///< transaction object for the burst commit
+
+	std::vector<socket_stats>	ic1_stats;													///< traffic statistics of the target sockets, followed by the initiator socket
 };
 #endif /*__INTERCONNECT1_H__*/
\ No newline at end of file
@@ -41,10 +41,12 @@ static const char *filename = "interconnect2.cpp"; ///< filename for reporting
 /// @details 
 ///		It initializes the vector <i> <b> ic2_isocket_array </b> </i> (private member).
 /// 	of initiator sockets and binds each of them to the module. It finally bind the target
-///		socket to the module.
+///		socket to the module. It also initializes the traffic statistics
+///		of each initiator socket.
 //
 //=======================================================================
-interconnect2::interconnect2( sc_module_name name)
+interconnect2::interconnect2( sc_module_name name
+							, const sc_core::sc_time glob_quantum)
 							: 
 							  ic2_tsocket("ic2_tsocket")
 							, ic2_isocket_array("ic2_isocket")
@@ -56,6 +58,11 @@ interconnect2::interconnect2( sc_module_name name)
 	{	
 		ic2_isocket_array[i].bind( *this ) ;
 	}
+	ic2_stats.resize(ic2_target_nr);
+	for (int i = 0; i<ic2_target_nr; i++)
+	{	
+		ic2_stats[i].init( ic2_isocket_array[i].basename(), glob_quantum ) ;
+	}
 	ic2_tsocket.bind( *this );
 }
 
@@ -97,7 +104,11 @@ tlm::tlm_sync_enum interconnect2::nb_transport_bw ( tlm::tlm_generic_payload& tO
 void interconnect2::b_transport (	tlm::tlm_generic_payload& tObj, 
 									sc_core::sc_time& delay				)
 {
-	return ic2_isocket_array[m_target_idx]->b_transport( tObj, delay );
+	sc_core::sc_time	delay_before	= delay;
+	unsigned int		idx				= m_target_idx;
+
+	ic2_isocket_array[idx]->b_transport( tObj, delay );
+	ic2_stats[idx].record( tObj.get_data_length(), delay_before, delay );
 }
 
 
@@ -128,9 +139,44 @@ tlm::tlm_sync_enum interconnect2::nb_transport_fw ( tlm::tlm_generic_payload& tO
 }
 	
 
+//==============================================================================
+/// @fn transport_dbg
+//
+/// @brief forwards the transport_dbg method call to the LM or the SEE component.
+//
+/// @details Unlike the timed calls, a debug call can be issued by any tool at 
+/// 	any time, so the target isn't given by #m_target_idx. It is decoded from the 
+/// 	address: each target has an address window of #dbg_window_size bytes in
+/// 	the order of the socket bindings. The address is restored after the call.
+//
+/// @retval number of bytes read or written by the target
+//==============================================================================
 unsigned int interconnect2::transport_dbg( tlm::tlm_generic_payload& tObj )
 {
-	return ic2_isocket_array[m_target_idx]->transport_dbg	( tObj );
-	
+	sc_dt::uint64	adr		= tObj.get_address();
+	unsigned int	idx		= (unsigned int)(adr / dbg_window_size);
+	unsigned int	nbytes	= 0;
+
+	if ( idx < ic2_target_number )
+	{
+		tObj.set_address( adr % dbg_window_size );
+		nbytes = ic2_isocket_array[idx]->transport_dbg	( tObj );
+		tObj.set_address( adr );
+	}
+	return nbytes;
 }
 
+
+
+//=======================================================================
+/// @fn end_of_simulation
+//
+/// @brief writes the traffic statistics of the sockets of IC2
+//
+/// @see write_stats_file()
+//
+//=======================================================================
+void interconnect2::end_of_simulation ( void )
+{
+	write_stats_file( name(), ic2_stats );
+}
\ No newline at end of file
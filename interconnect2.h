@@ -48,6 +48,7 @@
 
 
 #include "constants.h"
+#include "socket_stats.h"
 
 
 class interconnect2 :	public sc_module, 
@@ -57,6 +58,7 @@ class interconnect2 :	public sc_module,
 public:
 // Constructor ================================================================= 
 	interconnect2	( sc_module_name name 											///< sc module name
+					, const sc_core::sc_time glob_quantum							///< time value for the global quantum
 					);
 
 // Method Declarations =========================================================
@@ -86,16 +88,19 @@ public:
 											sc_core::sc_time& delay					///< ref to time delay
 										);
 
-	/// Required and unused interface method
 	unsigned int transport_dbg	( 	tlm::tlm_generic_payload& tObj					///< ref to transaction object 
 								);
 
+	/// writes the socket statistics at the end of the simulation
+	void end_of_simulation	( void );
+
 // Variable and Object Declarations ============================================
 	tlm::tlm_target_socket<buswidth2>	ic2_tsocket					;				///< standard target socket for communication with the monitor
 	sc_core::sc_vector< tlm::tlm_initiator_socket<buswidth2> > ic2_isocket_array;	///< vector of standard initiator sockets for communication with the LM and see
 
 private:
 	const unsigned int  ic2_target_nr;
+	std::vector<socket_stats>	ic2_stats;											///< traffic statistics of the initiator sockets
 
 };
 #endif /*__INTERCONNECT1_H__*/
\ No newline at end of file
@@ -41,9 +41,11 @@ static const char *filename = "interconnect3.cpp"; ///< filename for reporting
 ///		It initializes the vector of initiator sockets with the specified value of #ic3_target_nr which corresponds to o the module. 
 ///		<br>The number of initiator sockets is equal to the number of the GVOC or IC3 
 ///		Targets stored in the constant variable #ic3_target_nr.  
+///		<br>It also initializes the traffic statistics of each initiator socket.
 //
 //================================================================================
-interconnect3::interconnect3( sc_module_name name)
+interconnect3::interconnect3( sc_module_name name
+							, const sc_core::sc_time glob_quantum)
 							: 
 							  ic3_tsocket("ic3_tsocket")
 							, ic3_isocket_array("ic3_isocket")
@@ -54,6 +56,11 @@ interconnect3::interconnect3( sc_module_name name)
 	{	
 		ic3_isocket_array[i].bind( *this ) ;
 	}
+	ic3_stats.resize(ic3_target_nr);
+	for (int i = 0; i<ic3_target_nr; i++)
+	{	
+		ic3_stats[i].init( ic3_isocket_array[i].basename(), glob_quantum ) ;
+	}
 	ic3_tsocket.bind( *this );
 }
 
@@ -94,7 +101,11 @@ tlm::tlm_sync_enum interconnect3::nb_transport_bw ( tlm::tlm_generic_payload& tO
 void interconnect3::b_transport (	tlm::tlm_generic_payload& tObj, 
 									sc_core::sc_time& delay			  )
 {
-	return ic3_isocket_array[gvoc_target_idx]->b_transport( tObj, delay );
+	sc_core::sc_time	delay_before	= delay;
+	unsigned int		idx				= gvoc_target_idx;
+
+	ic3_isocket_array[idx]->b_transport( tObj, delay );
+	ic3_stats[idx].record( tObj.get_data_length(), delay_before, delay );
 }
 
 //==================================================================================
@@ -123,8 +134,43 @@ tlm::tlm_sync_enum interconnect3::nb_transport_fw ( tlm::tlm_generic_payload& tO
 }
 	
 
+//==============================================================================
+/// @fn transport_dbg
+//
+/// @brief forwards the transport_dbg method call to the Monitor or the SEE component.
+//
+/// @details Unlike the timed calls, a debug call can be issued by any tool at 
+/// 	any time, so the target isn't given by #gvoc_target_idx. It is decoded from the 
+/// 	address: each target has an address window of #dbg_window_size bytes in
+/// 	the order of the socket bindings. The address is restored after the call.
+//
+/// @retval number of bytes read or written by the target
+//==============================================================================
 unsigned int interconnect3::transport_dbg( tlm::tlm_generic_payload& tObj )
 {
-	return ic3_isocket_array[gvoc_target_idx]->transport_dbg	( tObj );
-	
+	sc_dt::uint64	adr		= tObj.get_address();
+	unsigned int	idx		= (unsigned int)(adr / dbg_window_size);
+	unsigned int	nbytes	= 0;
+
+	if ( idx < ic3_target_nr )
+	{
+		tObj.set_address( adr % dbg_window_size );
+		nbytes = ic3_isocket_array[idx]->transport_dbg	( tObj );
+		tObj.set_address( adr );
+	}
+	return nbytes;
 }
+
+
+//=======================================================================
+/// @fn end_of_simulation
+//
+/// @brief writes the traffic statistics of the sockets of IC3
+//
+/// @see write_stats_file()
+//
+//=======================================================================
+void interconnect3::end_of_simulation ( void )
+{
+	write_stats_file( name(), ic3_stats );
+}
\ No newline at end of file
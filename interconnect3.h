@@ -42,6 +42,7 @@
 #define __INTERCONNECT3_H__
 
 #include "constants.h"
+#include "socket_stats.h"
 #include <systemc.h>
 #include <tlm.h>
 
@@ -53,6 +54,7 @@ public:
 
 // Constructor ================================================================= 
 	interconnect3	( sc_module_name name											///< sc module name
+					, const sc_core::sc_time glob_quantum							///< time value for the global quantum
 					);
 
 // Method Declarations =========================================================
@@ -82,10 +84,12 @@ public:
 											sc_core::sc_time& delay					///< ref to time delay
 										);
 									
-	/// Required and unused interface method
 	unsigned int transport_dbg	( 	tlm::tlm_generic_payload& tObj 					///< ref to transaction object
 								);
 
+	/// writes the socket statistics at the end of the simulation
+	void end_of_simulation	( void );
+
 
 // Variable and Object Declarations ============================================
 	tlm::tlm_target_socket<buswidth3>	ic3_tsocket;								///< standard target socket for communication with gvoc
@@ -93,6 +97,7 @@ public:
 
 private:
 	const unsigned int  ic3_target_nr;
+	std::vector<socket_stats>	ic3_stats;											///< traffic statistics of the initiator sockets
 };
 
 #endif /* __INTERCONNECT_H__ */
\ No newline at end of file
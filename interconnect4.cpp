@@ -41,12 +41,14 @@ static const char *filename = "interconnect4.cpp"; ///< filename for reporting
 /// @details 
 ///     It initializes the vector <i> <b> ic4_isocket_array </b> </i> (private member) 
 /// 	with the number of the iC4 Targets specified during instantiation.<br>
-///		Finally the callbacks methods are registered for their use.
+///		Finally the callbacks methods are registered for their use and the traffic
+///		statistics of each initiator socket are initialized.
 ///		
 //
 //================================================================================
 interconnect4::interconnect4(	sc_module_name name										///< sc module name
 							,	const unsigned int isocket_number						///< number of initiator sockets
+							,	const sc_core::sc_time glob_quantum						///< time value for the global quantum
 							)
 							:
 							  ic4_isocket_nr(isocket_number)
@@ -63,6 +65,12 @@ interconnect4::interconnect4(	sc_module_name name										///< sc module name
 	ic4_tsocket.register_get_direct_mem_ptr	( this, &interconnect4::get_direct_mem_ptr	);
 	ic4_tsocket.register_nb_transport_fw	( this, &interconnect4::nb_transport_fw		);
 	ic4_tsocket.register_transport_dbg		( this, &interconnect4::transport_dbg		);
+
+	ic4_stats.resize(ic4_isocket_nr);
+	for (int i = 0; i<ic4_isocket_nr; i++)
+	{	
+		ic4_stats[i].init( ic4_isocket_array[i].basename(), glob_quantum );
+	}
 }
 
 //===============================================================================
@@ -101,14 +109,99 @@ tlm::tlm_sync_enum interconnect4::nb_transport_bw (	int id,							///< ID of the
 //
 /// @details #see_target_idx indicates the appropriate initiator socket through 
 /// 	which the call should be and is forwarded. It is set by the SEE component.
-/// 	
+/// 	A transaction carrying a multicast_extension is forwarded to its targets instead.
 // 
+/// @see multicast()
+//
 //==================================================================================
 void interconnect4::b_transport (	tlm::tlm_generic_payload& tObj, 					///< ref to transaction object
 									sc_core::sc_time& delay								///< ref to time delay	
 								)
 {
-	return ic4_isocket_array[see_target_idx]->b_transport( tObj, delay );
+	sc_core::sc_time	delay_before	= delay;
+	unsigned int		idx				= see_target_idx;
+	multicast_extension	*mc;
+
+	tObj.get_extension( mc );
+	if ( mc )
+	{
+		multicast( tObj, *mc, delay );
+		return;
+	}
+	ic4_isocket_array[idx]->b_transport( tObj, delay );
+	ic4_stats[idx].record( tObj.get_data_length(), delay_before, delay );
+}
+
+//==================================================================================
+/// @fn multicast
+//
+/// @brief forwards a transaction to each target of its multicast extension
+//
+/// @details Each target is called with the delay of the incoming call, since
+/// 	the targets are reached in parallel through their own sockets. The delay
+/// 	annotated by each target and its response are returned in the extension;
+/// 	the call returns the largest delay and the first error response. 
+/// 	In the scatter mode, the data pointer and length of the transaction are 
+/// 	set to the slice of each target and restored afterwards. A target whose 
+/// 	slice lies beyond the data or whose index has no socket isn't called.
+//
+//==================================================================================
+void interconnect4::multicast	(	tlm::tlm_generic_payload& tObj, 					///< ref to transaction object
+									multicast_extension& mc,							///< ref to the targets of the transaction
+									sc_core::sc_time& delay								///< ref to time delay	
+								)
+{
+	unsigned char				*data			= tObj.get_data_ptr();
+	unsigned int				length			= tObj.get_data_length();
+	unsigned int				width			= tObj.get_streaming_width();
+	unsigned int				count			= (unsigned int)mc.mc_targets.size();
+	sc_core::sc_time			delay_max		= delay;
+	tlm::tlm_response_status	status			= tlm::TLM_OK_RESPONSE;
+	unsigned int				idx;
+
+	mc.mc_delays.resize( count );
+	mc.mc_status.resize( count );
+	for (unsigned int i = 0; i < count; i++)
+	{
+		idx					= mc.mc_targets[i];
+		mc.mc_delays[i]		= delay;
+		if ( idx >= ic4_isocket_nr )
+		{
+			mc.mc_status[i]	= tlm::TLM_ADDRESS_ERROR_RESPONSE;
+		}
+		else if ( mc.mc_slice > 0 && (i + 1) * mc.mc_slice > length )
+		{
+			mc.mc_status[i]	= tlm::TLM_BURST_ERROR_RESPONSE;
+		}
+		else
+		{
+			if ( mc.mc_slice > 0 )
+			{
+				tObj.set_data_ptr		( data + i * mc.mc_slice	);
+				tObj.set_data_length	( mc.mc_slice				);
+				tObj.set_streaming_width( mc.mc_slice				);
+			}
+			tObj.set_response_status( tlm::TLM_INCOMPLETE_RESPONSE );
+			ic4_isocket_array[idx]->b_transport( tObj, mc.mc_delays[i] );
+			ic4_stats[idx].record( tObj.get_data_length(), delay, mc.mc_delays[i] );
+			mc.mc_status[i]	= tObj.get_response_status();
+		}
+
+		if ( mc.mc_status[i] != tlm::TLM_OK_RESPONSE && status == tlm::TLM_OK_RESPONSE )
+		{
+			status = mc.mc_status[i];
+		}
+		if ( mc.mc_delays[i] > delay_max )
+		{
+			delay_max = mc.mc_delays[i];
+		}
+	}
+
+	tObj.set_data_ptr			( data		);
+	tObj.set_data_length		( length	);
+	tObj.set_streaming_width	( width		);
+	tObj.set_response_status	( status	);
+	delay = delay_max;
 }
 
 //==================================================================================
@@ -139,9 +232,44 @@ tlm::tlm_sync_enum interconnect4::nb_transport_fw (	tlm::tlm_generic_payload& tO
 }
 	
 
+//==============================================================================
+/// @fn transport_dbg
+//
+/// @brief forwards the transport_dbg method call to an Actuator or an ExtAction component.
+//
+/// @details Unlike the timed calls, a debug call can be issued by any tool at 
+/// 	any time, so the target isn't given by #see_target_idx. It is decoded from the 
+/// 	address: each target has an address window of #dbg_window_size bytes in
+/// 	the order of the socket bindings. The address is restored after the call.
+//
+/// @retval number of bytes read or written by the target
+//==============================================================================
 unsigned int interconnect4::transport_dbg ( tlm::tlm_generic_payload& tObj 				///< ref to transaction object
 										  )
 {
-	return ic4_isocket_array[see_target_idx]->transport_dbg	( tObj );
-	
+	sc_dt::uint64	adr		= tObj.get_address();
+	unsigned int	idx		= (unsigned int)(adr / dbg_window_size);
+	unsigned int	nbytes	= 0;
+
+	if ( idx < ic4_isocket_nr )
+	{
+		tObj.set_address( adr % dbg_window_size );
+		nbytes = ic4_isocket_array[idx]->transport_dbg	( tObj );
+		tObj.set_address( adr );
+	}
+	return nbytes;
 }
+
+
+//=======================================================================
+/// @fn end_of_simulation
+//
+/// @brief writes the traffic statistics of the sockets of IC4
+//
+/// @see write_stats_file()
+//
+//=======================================================================
+void interconnect4::end_of_simulation ( void )
+{
+	write_stats_file( name(), ic4_stats );
+}
\ No newline at end of file
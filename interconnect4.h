@@ -35,7 +35,8 @@
 //
 ///  @details
 ///		It forwards the methods calls from the SEE to the components actuators and 
-///		extaction.
+///		extaction. A write carrying a multicast_extension is delivered to several 
+///		of them in one call.
 //
 //==============================================================================
 
@@ -48,6 +49,8 @@
 #include <tlm_utils\simple_initiator_socket.h>	// TLM headers
 
 #include "constants.h"
+#include "socket_stats.h"
+#include "multicast_extension.h"
 
 class interconnect4: public sc_module
 {
@@ -55,6 +58,7 @@ public:
 // Constructor ================================================================= 
 	interconnect4	(	sc_module_name name										///< sc module name
 					,	const unsigned int isocket_number						///< number of initiator sockets
+					,	const sc_core::sc_time glob_quantum						///< time value for the global quantum
 					);
 
 // Method Declarations =========================================================
@@ -87,16 +91,24 @@ public:
 											sc_core::sc_time& delay				///< ref to time delay
 										);
 										
-    /// Required and unused interface method
 	unsigned int transport_dbg	( 	tlm::tlm_generic_payload& tObj 				///< ref to transaction object
 								);
 
+	/// writes the socket statistics at the end of the simulation
+	void end_of_simulation	( void );
+
 // Variable and Object Declarations ============================================
 	tlm_utils::simple_target_socket<interconnect4, buswidth4>				ic4_tsocket;						///< simple target socket for communication with see
 	sc_core::sc_vector<tlm_utils::simple_initiator_socket_tagged<interconnect4, buswidth4>> ic4_isocket_array; ///< vector of standard initiator sockets for communication with actuator and extaction
 	
 private:
 	const unsigned int			ic4_isocket_nr;									///< number of IC4 target components
+	std::vector<socket_stats>	ic4_stats;										///< traffic statistics of the initiator sockets
+
+	void multicast			(	tlm::tlm_generic_payload& tObj, 				///< ref to transaction object
+								multicast_extension& mc,						///< ref to the targets of the transaction
+								sc_core::sc_time& delay							///< ref to time delay
+							);
 	
 };
 
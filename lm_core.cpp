@@ -31,16 +31,35 @@
 #include <algorithm>
 #include <math.h>
 
+static const char *filename = "lm_core.cpp";								///< filename for reporting
+
 
 //======================================================================
 /// @fn lm_core
 //
 /// @brief constructor
 //
+/// @details It loads the limits of the channels if a limits file is given.
+///		If the file can't be loaded, LM runs without limit checking.
 //======================================================================
 lm_core::lm_core( std::string node_name_ 										///< basename of the node component
+				, unsigned int sae_data_length_									///< length of a sensor dataset
+				, unsigned int result_data_length_								///< length of the result data
+				, const char* limits_file_										///< limits file of the channels, 0 without limit checking
 				 ): lmcore_parent_name(node_name_)
+				 , lmcore_sae_dl(sae_data_length_)
+				 , lmcore_result_dl(result_data_length_)
+				 , lmcore_result_slot(0)
 {
+	if ( limits_file_ )
+	{
+		if ( !lmcore_limits.load( limits_file_ ) )
+		{
+			std::ostringstream	msg;
+			msg << "\t" << lmcore_parent_name << ": limits file " << limits_file_ << " rejected, LM runs without limit checking!";
+			WARNING_LOG(filename, __FUNCTION__, msg.str());
+		}
+	}
 }
 
 
@@ -49,10 +68,79 @@ lm_core::lm_core( std::string node_name_ 										///< basename of the node com
 //
 /// @brief evaluates the sensor data
 //
-/// @details To be implemented according to the system under investigation
+/// @details 
+///		With a limits file, the dataset is checked against the limits of its
+///		channels and status is set to ACTION_NEEDED if a check is violated.
+///		The slot is the index of the dataset in the sae cycle, so that its rate
+///		of change is checked against the previous data of the same dataset.
+///		Otherwise to be implemented according to the system under investigation
+//======================================================================
+void lm_core::evaluate_data(unsigned char* data, unsigned int slot, notification::report_actions &status)
+{
+	if ( lmcore_limits.channels() > 0 && lmcore_limits.check(data, lmcore_sae_dl, slot) > 0 )
+	{
+		status				= notification::ACTION_NEEDED;
+		lmcore_result_slot	= slot;
+	}
+}
+
+//======================================================================
+/// @fn evaluate_batch
+//
+/// @brief evaluates the sensor data of a whole sae cycle
+//
+/// @details
+///		The n_sets datasets lie stride bytes apart in data. The verdict of
+///		each dataset is initialized by the caller with the status of the read 
+///		transaction. Only the datasets flagged in dirty are evaluated, the 
+///		verdicts of the others are kept; an empty dirty vector flags all datasets.
+///		All datasets are evaluated, if their verdicts can't be reused ( reuses_verdicts() ). 
+///		With a limits file, each dataset is checked in its own
+///		slot, so that its rate of change is checked against the same dataset
+///		of the previous cycle. The excess of the first dataset needing actions 
+///		is the next result data. Otherwise each dataset is evaluated by 
+///		evaluate_data(); it can be replaced by an evaluation of all datasets at once.
+//======================================================================
+void lm_core::evaluate_batch(unsigned char* data, unsigned int n_sets, unsigned int stride,
+							 std::vector<notification::report_actions> &verdicts,
+							 const std::vector<bool> &dirty)
+{
+	bool	result_found	= false;
+
+	for (unsigned int i = 0; i < n_sets; i++)
+	{
+		if ( i < dirty.size() && !dirty[i] && reuses_verdicts() )
+		{
+			continue;
+		}
+		if ( lmcore_limits.channels() == 0 )
+		{
+			evaluate_data(data + i*stride, i, verdicts[i]);
+		}
+		else if ( lmcore_limits.check(data + i*stride, stride, i) > 0 )
+		{
+			verdicts[i] = notification::ACTION_NEEDED;
+			if ( !result_found )
+			{
+				lmcore_result_slot	= i;
+				result_found		= true;
+			}
+		}
+	}
+}
+
+//======================================================================
+/// @fn reuses_verdicts
+//
+/// @brief returns true if the verdict of an unchanged dataset can be reused
+//
+/// @details With rate of change limits, the verdict depends on the change 
+///		since the previous data of the slot: an unchanged dataset has to be
+///		checked again, e.g. to clear the ACTION_NEEDED of its last change.
 //======================================================================
-void lm_core::evaluate_data(unsigned char* data, notification::report_actions &status)
+bool lm_core::reuses_verdicts(void) const
 {
+	return !lmcore_limits.rate_checked();
 }
 
 //======================================================================
@@ -61,8 +149,14 @@ void lm_core::evaluate_data(unsigned char* data, notification::report_actions &s
 /// @brief receives data from the LModel Component
 //
 /// @details
-///		To be implemented according to the system under investigation
+///		With a limits file, the result data is the excess of each channel 
+///		over its limits (difference vector). Otherwise to be implemented 
+///		according to the system under investigation
 //======================================================================
 void lm_core::send_data(unsigned char* data)
 {
+	if ( lmcore_limits.channels() > 0 )
+	{
+		lmcore_limits.copy_excess(data, lmcore_result_dl, lmcore_result_slot);
+	}
 }
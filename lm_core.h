@@ -42,19 +42,30 @@
 #include "reporting.h"
 #include "constants.h"
 #include "key_functions.h"
+#include "lm_limits.h"
 #include <vector>
 
 class lm_core
 {
 public:
 	lm_core	( std::string node_name_ 							///< basename of the node component
+			, unsigned int sae_data_length_						///< length of a sensor dataset
+			, unsigned int result_data_length_					///< length of the result data
+			, const char* limits_file_							///< limits file of the channels, 0 without limit checking
 			);
 
-	void evaluate_data(unsigned char*, notification::report_actions &status);	
+	void evaluate_data(unsigned char*, unsigned int slot, notification::report_actions &status);	// slot: index of the dataset in the sae cycle
+	void evaluate_batch(unsigned char*, unsigned int n_sets, unsigned int stride,	// evaluates the datasets of a whole sae cycle
+						std::vector<notification::report_actions> &verdicts,
+						const std::vector<bool> &dirty);
 	void send_data(unsigned char*);								// convert result data: from datyp to char
+	bool reuses_verdicts(void) const;							// true if the verdict of an unchanged dataset can be reused
 
 private:
 	std::string lmcore_output_file, lmcore_parent_name;
+	unsigned int lmcore_sae_dl, lmcore_result_dl;				///< data lengths
+	unsigned int lmcore_result_slot;							///< slot of the dataset whose excess is sent as result data
+	lm_limits lmcore_limits;									///< limits of the channels
 };
 
 #endif
\ No newline at end of file
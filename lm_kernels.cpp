@@ -0,0 +1,562 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "lm_kernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LM_KERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define LM_TARGET_SSE2
+#define LM_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define LM_TARGET_SSE2	__attribute__((target("sse2")))
+#define LM_TARGET_AVX2	__attribute__((target("avx2")))
+#endif
+#endif
+
+namespace lm_kernels
+{
+
+//======================================================================
+//	scalar kernels, also used for the tails of the vector kernels
+//======================================================================
+
+static inline int saturate16( int value )
+{
+	return ( value > 32767 ) ? 32767 : ( ( value < -32768 ) ? -32768 : value );
+}
+
+static unsigned int band_scalar( const unsigned char* x, const unsigned char* low, const unsigned char* high, unsigned char* excess, unsigned int n )
+{
+	unsigned int	count	= 0;
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		int		below	= low[i] - x[i];
+		int		above	= x[i] - high[i];
+		int		e		= ( below > above ) ? below : above;
+
+		excess[i] = (unsigned char)( ( e > 0 ) ? e : 0 );
+		count += ( e > 0 );
+	}
+	return count;
+}
+
+static unsigned int band_scalar( const short* x, const short* low, const short* high, short* excess, unsigned int n )
+{
+	unsigned int	count	= 0;
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		int		below	= saturate16( low[i] - x[i] );
+		int		above	= saturate16( x[i] - high[i] );
+		int		e		= ( below > above ) ? below : above;
+
+		excess[i] = (short)( ( e > 0 ) ? e : 0 );
+		count += ( e > 0 );
+	}
+	return count;
+}
+
+static unsigned int band_scalar( const float* x, const float* low, const float* high, float* excess, unsigned int n )
+{
+	unsigned int	count	= 0;
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		float	below	= low[i] - x[i];
+		float	above	= x[i] - high[i];
+		float	e		= ( below > above ) ? below : above;
+
+		excess[i] = ( e > 0.0f ) ? e : 0.0f;
+		count += ( excess[i] > 0.0f );
+	}
+	return count;
+}
+
+static unsigned int deviation_scalar( const unsigned char* x, const unsigned char* ref, const unsigned char* tol, unsigned char* excess, unsigned int n )
+{
+	unsigned int	count	= 0;
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		int		d		= ( x[i] > ref[i] ) ? x[i] - ref[i] : ref[i] - x[i];
+		int		e		= d - tol[i];
+
+		if ( e > 0 )
+		{
+			count++;
+			if ( e > excess[i] )
+				excess[i] = (unsigned char)e;
+		}
+	}
+	return count;
+}
+
+static unsigned int deviation_scalar( const short* x, const short* ref, const short* tol, short* excess, unsigned int n )
+{
+	unsigned int	count	= 0;
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		int		up		= saturate16( x[i] - ref[i] );
+		int		down	= saturate16( ref[i] - x[i] );
+		int		e		= saturate16( ( ( up > down ) ? up : down ) - tol[i] );
+
+		if ( e > 0 )
+		{
+			count++;
+			if ( e > excess[i] )
+				excess[i] = (short)e;
+		}
+	}
+	return count;
+}
+
+static unsigned int deviation_scalar( const float* x, const float* ref, const float* tol, float* excess, unsigned int n )
+{
+	unsigned int	count	= 0;
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		float	d		= x[i] - ref[i];
+		float	e		= ( ( d < 0.0f ) ? -d : d ) - tol[i];
+
+		if ( e > 0.0f )
+		{
+			count++;
+			if ( !( excess[i] > e ) )
+				excess[i] = e;
+		}
+	}
+	return count;
+}
+
+
+#ifdef LM_KERNELS_X86
+
+static inline unsigned int count_bits( unsigned int mask )
+{
+	unsigned int	count	= 0;
+
+	for ( ; mask != 0; mask &= mask - 1 )
+	{
+		count++;
+	}
+	return count;
+}
+
+//======================================================================
+//	SSE2 kernels
+//======================================================================
+
+LM_TARGET_SSE2 static unsigned int band_sse2( const unsigned char* x, const unsigned char* low, const unsigned char* high, unsigned char* excess, unsigned int n )
+{
+	const __m128i	zero	= _mm_setzero_si128();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 16 <= n; i += 16 )
+	{
+		__m128i	vx	= _mm_loadu_si128( (const __m128i*)(x + i) );
+		__m128i	e	= _mm_max_epu8( _mm_subs_epu8( _mm_loadu_si128( (const __m128i*)(low + i) ), vx ),
+									_mm_subs_epu8( vx, _mm_loadu_si128( (const __m128i*)(high + i) ) ) );
+
+		_mm_storeu_si128( (__m128i*)(excess + i), e );
+		count += 16 - count_bits( (unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( e, zero ) ) );
+	}
+	return count + band_scalar( x + i, low + i, high + i, excess + i, n - i );
+}
+
+LM_TARGET_SSE2 static unsigned int band_sse2( const short* x, const short* low, const short* high, short* excess, unsigned int n )
+{
+	const __m128i	zero	= _mm_setzero_si128();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 8 <= n; i += 8 )
+	{
+		__m128i	vx	= _mm_loadu_si128( (const __m128i*)(x + i) );
+		__m128i	e	= _mm_max_epi16( _mm_subs_epi16( _mm_loadu_si128( (const __m128i*)(low + i) ), vx ),
+									 _mm_subs_epi16( vx, _mm_loadu_si128( (const __m128i*)(high + i) ) ) );
+
+		e = _mm_max_epi16( e, zero );
+		_mm_storeu_si128( (__m128i*)(excess + i), e );
+		count += count_bits( (unsigned int)_mm_movemask_epi8( _mm_cmpgt_epi16( e, zero ) ) ) / 2;
+	}
+	return count + band_scalar( x + i, low + i, high + i, excess + i, n - i );
+}
+
+LM_TARGET_SSE2 static unsigned int band_sse2( const float* x, const float* low, const float* high, float* excess, unsigned int n )
+{
+	const __m128	zero	= _mm_setzero_ps();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 4 <= n; i += 4 )
+	{
+		__m128	vx	= _mm_loadu_ps( x + i );
+		__m128	e	= _mm_max_ps( _mm_sub_ps( _mm_loadu_ps( low + i ), vx ), _mm_sub_ps( vx, _mm_loadu_ps( high + i ) ) );
+
+		e = _mm_max_ps( e, zero );
+		_mm_storeu_ps( excess + i, e );
+		count += count_bits( (unsigned int)_mm_movemask_ps( _mm_cmpgt_ps( e, zero ) ) );
+	}
+	return count + band_scalar( x + i, low + i, high + i, excess + i, n - i );
+}
+
+LM_TARGET_SSE2 static unsigned int deviation_sse2( const unsigned char* x, const unsigned char* ref, const unsigned char* tol, unsigned char* excess, unsigned int n )
+{
+	const __m128i	zero	= _mm_setzero_si128();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 16 <= n; i += 16 )
+	{
+		__m128i	vx	= _mm_loadu_si128( (const __m128i*)(x + i) );
+		__m128i	vr	= _mm_loadu_si128( (const __m128i*)(ref + i) );
+		__m128i	d	= _mm_max_epu8( _mm_subs_epu8( vx, vr ), _mm_subs_epu8( vr, vx ) );
+		__m128i	e	= _mm_subs_epu8( d, _mm_loadu_si128( (const __m128i*)(tol + i) ) );
+
+		_mm_storeu_si128( (__m128i*)(excess + i), _mm_max_epu8( e, _mm_loadu_si128( (const __m128i*)(excess + i) ) ) );
+		count += 16 - count_bits( (unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( e, zero ) ) );
+	}
+	return count + deviation_scalar( x + i, ref + i, tol + i, excess + i, n - i );
+}
+
+LM_TARGET_SSE2 static unsigned int deviation_sse2( const short* x, const short* ref, const short* tol, short* excess, unsigned int n )
+{
+	const __m128i	zero	= _mm_setzero_si128();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 8 <= n; i += 8 )
+	{
+		__m128i	vx	= _mm_loadu_si128( (const __m128i*)(x + i) );
+		__m128i	vr	= _mm_loadu_si128( (const __m128i*)(ref + i) );
+		__m128i	d	= _mm_max_epi16( _mm_subs_epi16( vx, vr ), _mm_subs_epi16( vr, vx ) );
+		__m128i	e	= _mm_max_epi16( _mm_subs_epi16( d, _mm_loadu_si128( (const __m128i*)(tol + i) ) ), zero );
+
+		_mm_storeu_si128( (__m128i*)(excess + i), _mm_max_epi16( e, _mm_loadu_si128( (const __m128i*)(excess + i) ) ) );
+		count += count_bits( (unsigned int)_mm_movemask_epi8( _mm_cmpgt_epi16( e, zero ) ) ) / 2;
+	}
+	return count + deviation_scalar( x + i, ref + i, tol + i, excess + i, n - i );
+}
+
+LM_TARGET_SSE2 static unsigned int deviation_sse2( const float* x, const float* ref, const float* tol, float* excess, unsigned int n )
+{
+	const __m128	zero	= _mm_setzero_ps();
+	const __m128	sign	= _mm_set1_ps( -0.0f );
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 4 <= n; i += 4 )
+	{
+		__m128	d	= _mm_andnot_ps( sign, _mm_sub_ps( _mm_loadu_ps( x + i ), _mm_loadu_ps( ref + i ) ) );
+		__m128	e	= _mm_max_ps( _mm_sub_ps( d, _mm_loadu_ps( tol + i ) ), zero );
+
+		_mm_storeu_ps( excess + i, _mm_max_ps( _mm_loadu_ps( excess + i ), e ) );
+		count += count_bits( (unsigned int)_mm_movemask_ps( _mm_cmpgt_ps( e, zero ) ) );
+	}
+	return count + deviation_scalar( x + i, ref + i, tol + i, excess + i, n - i );
+}
+
+//======================================================================
+//	AVX2 kernels
+//======================================================================
+
+LM_TARGET_AVX2 static unsigned int band_avx2( const unsigned char* x, const unsigned char* low, const unsigned char* high, unsigned char* excess, unsigned int n )
+{
+	const __m256i	zero	= _mm256_setzero_si256();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 32 <= n; i += 32 )
+	{
+		__m256i	vx	= _mm256_loadu_si256( (const __m256i*)(x + i) );
+		__m256i	e	= _mm256_max_epu8( _mm256_subs_epu8( _mm256_loadu_si256( (const __m256i*)(low + i) ), vx ),
+									   _mm256_subs_epu8( vx, _mm256_loadu_si256( (const __m256i*)(high + i) ) ) );
+
+		_mm256_storeu_si256( (__m256i*)(excess + i), e );
+		count += 32 - count_bits( (unsigned int)_mm256_movemask_epi8( _mm256_cmpeq_epi8( e, zero ) ) );
+	}
+	return count + band_scalar( x + i, low + i, high + i, excess + i, n - i );
+}
+
+LM_TARGET_AVX2 static unsigned int band_avx2( const short* x, const short* low, const short* high, short* excess, unsigned int n )
+{
+	const __m256i	zero	= _mm256_setzero_si256();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 16 <= n; i += 16 )
+	{
+		__m256i	vx	= _mm256_loadu_si256( (const __m256i*)(x + i) );
+		__m256i	e	= _mm256_max_epi16( _mm256_subs_epi16( _mm256_loadu_si256( (const __m256i*)(low + i) ), vx ),
+										_mm256_subs_epi16( vx, _mm256_loadu_si256( (const __m256i*)(high + i) ) ) );
+
+		e = _mm256_max_epi16( e, zero );
+		_mm256_storeu_si256( (__m256i*)(excess + i), e );
+		count += count_bits( (unsigned int)_mm256_movemask_epi8( _mm256_cmpgt_epi16( e, zero ) ) ) / 2;
+	}
+	return count + band_scalar( x + i, low + i, high + i, excess + i, n - i );
+}
+
+LM_TARGET_AVX2 static unsigned int band_avx2( const float* x, const float* low, const float* high, float* excess, unsigned int n )
+{
+	const __m256	zero	= _mm256_setzero_ps();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 8 <= n; i += 8 )
+	{
+		__m256	vx	= _mm256_loadu_ps( x + i );
+		__m256	e	= _mm256_max_ps( _mm256_sub_ps( _mm256_loadu_ps( low + i ), vx ), _mm256_sub_ps( vx, _mm256_loadu_ps( high + i ) ) );
+
+		e = _mm256_max_ps( e, zero );
+		_mm256_storeu_ps( excess + i, e );
+		count += count_bits( (unsigned int)_mm256_movemask_ps( _mm256_cmp_ps( e, zero, _CMP_GT_OQ ) ) );
+	}
+	return count + band_scalar( x + i, low + i, high + i, excess + i, n - i );
+}
+
+LM_TARGET_AVX2 static unsigned int deviation_avx2( const unsigned char* x, const unsigned char* ref, const unsigned char* tol, unsigned char* excess, unsigned int n )
+{
+	const __m256i	zero	= _mm256_setzero_si256();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 32 <= n; i += 32 )
+	{
+		__m256i	vx	= _mm256_loadu_si256( (const __m256i*)(x + i) );
+		__m256i	vr	= _mm256_loadu_si256( (const __m256i*)(ref + i) );
+		__m256i	d	= _mm256_max_epu8( _mm256_subs_epu8( vx, vr ), _mm256_subs_epu8( vr, vx ) );
+		__m256i	e	= _mm256_subs_epu8( d, _mm256_loadu_si256( (const __m256i*)(tol + i) ) );
+
+		_mm256_storeu_si256( (__m256i*)(excess + i), _mm256_max_epu8( e, _mm256_loadu_si256( (const __m256i*)(excess + i) ) ) );
+		count += 32 - count_bits( (unsigned int)_mm256_movemask_epi8( _mm256_cmpeq_epi8( e, zero ) ) );
+	}
+	return count + deviation_scalar( x + i, ref + i, tol + i, excess + i, n - i );
+}
+
+LM_TARGET_AVX2 static unsigned int deviation_avx2( const short* x, const short* ref, const short* tol, short* excess, unsigned int n )
+{
+	const __m256i	zero	= _mm256_setzero_si256();
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 16 <= n; i += 16 )
+	{
+		__m256i	vx	= _mm256_loadu_si256( (const __m256i*)(x + i) );
+		__m256i	vr	= _mm256_loadu_si256( (const __m256i*)(ref + i) );
+		__m256i	d	= _mm256_max_epi16( _mm256_subs_epi16( vx, vr ), _mm256_subs_epi16( vr, vx ) );
+		__m256i	e	= _mm256_max_epi16( _mm256_subs_epi16( d, _mm256_loadu_si256( (const __m256i*)(tol + i) ) ), zero );
+
+		_mm256_storeu_si256( (__m256i*)(excess + i), _mm256_max_epi16( e, _mm256_loadu_si256( (const __m256i*)(excess + i) ) ) );
+		count += count_bits( (unsigned int)_mm256_movemask_epi8( _mm256_cmpgt_epi16( e, zero ) ) ) / 2;
+	}
+	return count + deviation_scalar( x + i, ref + i, tol + i, excess + i, n - i );
+}
+
+LM_TARGET_AVX2 static unsigned int deviation_avx2( const float* x, const float* ref, const float* tol, float* excess, unsigned int n )
+{
+	const __m256	zero	= _mm256_setzero_ps();
+	const __m256	sign	= _mm256_set1_ps( -0.0f );
+	unsigned int	count	= 0;
+	unsigned int	i		= 0;
+
+	for ( ; i + 8 <= n; i += 8 )
+	{
+		__m256	d	= _mm256_andnot_ps( sign, _mm256_sub_ps( _mm256_loadu_ps( x + i ), _mm256_loadu_ps( ref + i ) ) );
+		__m256	e	= _mm256_max_ps( _mm256_sub_ps( d, _mm256_loadu_ps( tol + i ) ), zero );
+
+		_mm256_storeu_ps( excess + i, _mm256_max_ps( _mm256_loadu_ps( excess + i ), e ) );
+		count += count_bits( (unsigned int)_mm256_movemask_ps( _mm256_cmp_ps( e, zero, _CMP_GT_OQ ) ) );
+	}
+	return count + deviation_scalar( x + i, ref + i, tol + i, excess + i, n - i );
+}
+
+//======================================================================
+//	detection of the host
+//======================================================================
+
+static void read_cpuid( unsigned int leaf, unsigned int regs[4] )
+{
+#ifdef _MSC_VER
+	__cpuidex( (int*)regs, (int)leaf, 0 );
+#else
+	__cpuid_count( leaf, 0, regs[0], regs[1], regs[2], regs[3] );
+#endif
+}
+
+static unsigned long long read_xcr0( void )
+{
+#ifdef _MSC_VER
+	return _xgetbv( 0 );
+#else
+	unsigned int	lo, hi;
+
+	__asm__ __volatile__ ( "xgetbv" : "=a"(lo), "=d"(hi) : "c"(0) );
+	return ( (unsigned long long)hi << 32 ) | lo;
+#endif
+}
+
+#endif /*LM_KERNELS_X86*/
+
+
+//======================================================================
+//	dispatch
+//======================================================================
+
+static isa_level	active_isa	= ISA_SCALAR;
+static bool			isa_known	= false;
+
+
+//======================================================================
+/// @fn detect_isa
+//
+/// @brief determines the highest instruction set supported by the host.
+//
+/// @details AVX2 also requires the operating system to save the ymm 
+///		registers (OSXSAVE and XCR0).
+//======================================================================
+isa_level detect_isa( void )
+{
+#ifdef LM_KERNELS_X86
+	unsigned int	regs[4];
+	unsigned int	max_leaf;
+
+	read_cpuid( 0, regs );
+	max_leaf = regs[0];
+	if ( max_leaf < 1 )
+		return ISA_SCALAR;
+
+	read_cpuid( 1, regs );
+	bool	sse2	= ( regs[3] & (1u << 26) ) != 0;
+	bool	osxsave	= ( regs[2] & (1u << 27) ) != 0;
+	bool	avx		= ( regs[2] & (1u << 28) ) != 0;
+
+	if ( sse2 && osxsave && avx && max_leaf >= 7 && ( read_xcr0() & 0x6 ) == 0x6 )
+	{
+		read_cpuid( 7, regs );
+		if ( regs[1] & (1u << 5) )
+			return ISA_AVX2;
+	}
+	if ( sse2 )
+		return ISA_SSE2;
+#endif
+	return ISA_SCALAR;
+}
+
+//======================================================================
+/// @fn get_isa
+//
+/// @brief returns the instruction set of the kernels in use. At the first
+///		call, it is the highest one supported by the host.
+//======================================================================
+isa_level get_isa( void )
+{
+	if ( !isa_known )
+	{
+		active_isa	= detect_isa();
+		isa_known	= true;
+	}
+	return active_isa;
+}
+
+//======================================================================
+/// @fn set_isa
+//
+/// @brief selects the instruction set of the kernels, at most the
+///		highest one supported by the host.
+//======================================================================
+void set_isa( isa_level level )
+{
+	isa_level	host	= detect_isa();
+
+	active_isa	= ( level < host ) ? level : host;
+	isa_known	= true;
+}
+
+const char* isa_name( isa_level level )
+{
+	switch ( level )
+	{
+		case ISA_AVX2:	return "AVX2";
+		case ISA_SSE2:	return "SSE2";
+		default:		return "SCALAR";
+	}
+}
+
+#ifdef LM_KERNELS_X86
+#define LM_DISPATCH(kernel, args)										\
+	switch ( get_isa() )												\
+	{																	\
+		case ISA_AVX2:	return kernel##_avx2 args;						\
+		case ISA_SSE2:	return kernel##_sse2 args;						\
+		default:		return kernel##_scalar args;					\
+	}
+#else
+#define LM_DISPATCH(kernel, args)	return kernel##_scalar args;
+#endif
+
+unsigned int band( const unsigned char* x, const unsigned char* low, const unsigned char* high, unsigned char* excess, unsigned int n )
+{
+	LM_DISPATCH( band, (x, low, high, excess, n) )
+}
+
+unsigned int band( const short* x, const short* low, const short* high, short* excess, unsigned int n )
+{
+	LM_DISPATCH( band, (x, low, high, excess, n) )
+}
+
+unsigned int band( const float* x, const float* low, const float* high, float* excess, unsigned int n )
+{
+	LM_DISPATCH( band, (x, low, high, excess, n) )
+}
+
+unsigned int deviation( const unsigned char* x, const unsigned char* ref, const unsigned char* tol, unsigned char* excess, unsigned int n )
+{
+	LM_DISPATCH( deviation, (x, ref, tol, excess, n) )
+}
+
+unsigned int deviation( const short* x, const short* ref, const short* tol, short* excess, unsigned int n )
+{
+	LM_DISPATCH( deviation, (x, ref, tol, excess, n) )
+}
+
+unsigned int deviation( const float* x, const float* ref, const float* tol, float* excess, unsigned int n )
+{
+	LM_DISPATCH( deviation, (x, ref, tol, excess, n) )
+}
+
+}
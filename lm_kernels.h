@@ -0,0 +1,74 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file lm_kernels.h
+//
+///  @brief These are the limit checking kernels of the lmodel component
+///
+///  @details
+///		Each kernel checks n channels at once and returns the number of
+///		channels that violate the check. The excess of each channel over its
+///		limits is written into the difference vector. The kernels exist for
+///		unsigned 8 bit, signed 16 bit and float samples; the integer kernels
+///		saturate. <br>
+///		They are implemented with AVX2, SSE2 and in plain C++. The fastest
+///		implementation supported by the host is selected at runtime.
+//		
+//==============================================================================
+
+#ifndef __LM_KERNELS_H__
+#define __LM_KERNELS_H__
+
+namespace lm_kernels
+{
+	enum isa_level
+	{
+		ISA_SCALAR		=	0,										///< plain C++
+		ISA_SSE2		=	1,										///< 128 bit vectors
+		ISA_AVX2		=	2										///< 256 bit vectors
+	};
+
+	isa_level		detect_isa	( void );							// highest level supported by the host
+	isa_level		get_isa		( void );							// level of the kernels in use
+	void			set_isa		( isa_level level );				// limits the level of the kernels in use
+	const char*		isa_name	( isa_level level );
+
+	// band check: excess = max(low - x, x - high, 0)
+	unsigned int	band		( const unsigned char* x, const unsigned char* low, const unsigned char* high, unsigned char* excess, unsigned int n );
+	unsigned int	band		( const short* x, const short* low, const short* high, short* excess, unsigned int n );
+	unsigned int	band		( const float* x, const float* low, const float* high, float* excess, unsigned int n );
+
+	// deviation check: excess = max(excess, |x - ref| - tol, 0)
+	unsigned int	deviation	( const unsigned char* x, const unsigned char* ref, const unsigned char* tol, unsigned char* excess, unsigned int n );
+	unsigned int	deviation	( const short* x, const short* ref, const short* tol, short* excess, unsigned int n );
+	unsigned int	deviation	( const float* x, const float* ref, const float* tol, float* excess, unsigned int n );
+}
+
+#endif /*__LM_KERNELS_H__*/
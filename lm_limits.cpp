@@ -0,0 +1,335 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "lm_limits.h"
+#include "lm_kernels.h"
+#include "constants.h"
+#include "reporting.h"
+
+static const char *filename = "lm_limits.cpp";
+
+
+//======================================================================
+/// @fn to_sample
+//
+/// @brief converts a value of the limits file into a sample, saturated
+///		to the range of the sample type.
+//
+//======================================================================
+template <typename T>
+static T to_sample( double value )
+{
+	if ( !std::numeric_limits<T>::is_integer )
+		return T(value);
+
+	if ( value <= double(std::numeric_limits<T>::min()) )
+		return std::numeric_limits<T>::min();
+	if ( value >= double(std::numeric_limits<T>::max()) )
+		return std::numeric_limits<T>::max();
+	return T( ( value < 0 ) ? value - 0.5 : value + 0.5 );
+}
+
+//======================================================================
+/// @fn no_limit
+//
+/// @brief limit of a check which is not configured, it is never exceeded.
+//
+//======================================================================
+template <typename T>
+static T no_limit( void )
+{
+	return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+}
+
+
+//======================================================================
+/// @fn lm_limits
+//
+/// @brief constructor. The table has no channel.
+//
+//======================================================================
+lm_limits::lm_limits ( void )
+	: ll_type		( ST_UINT8	)
+	, ll_channels	( 0			)
+	, ll_rate		( false		)
+	, ll_deviation	( false		)
+{
+}
+
+
+//======================================================================
+/// @fn load
+//
+/// @brief reads the sample type and the channels of a limits file
+//
+/// @details A malformed file is rejected as a whole: the channels read
+///		before the malformed line are cleared again, so that the table is
+///		never partial.
+//
+/// @retval false if the file couldn't be opened or is malformed
+//
+//======================================================================
+bool lm_limits::load ( const char* file_name )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(INPUTDIR) + std::string(file_name);
+	std::ifstream		infile( strfname.c_str() );
+	std::string			line;
+
+	if ( !infile.is_open() )
+	{
+		msg << "i couldn't open file " << strfname << "!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		return false;
+	}
+
+	while ( std::getline(infile, line) )
+	{
+		std::istringstream	fields( line );
+		std::vector<double>	values;
+		std::string			word;
+		double				value;
+
+		if ( line.empty() || line[0] == '#' || !(fields >> word) )
+		{
+			continue;
+		}
+		if ( word == "type" )
+		{
+			fields >> word;
+			if ( ll_channels > 0 || ( word != "uint8" && word != "int16" && word != "float" ) )
+			{
+				msg << strfname << ": the type must be uint8, int16 or float and precede the channels!";
+				ERROR_LOG(filename, __FUNCTION__, msg.str());
+				clear();
+				return false;
+			}
+			ll_type = ( word == "uint8" ) ? ST_UINT8 : ( ( word == "int16" ) ? ST_INT16 : ST_FLOAT );
+			continue;
+		}
+
+		fields.clear();
+		fields.str( line );
+		while ( fields >> value )
+		{
+			values.push_back( value );
+		}
+		if ( values.size() < 2 || values.size() == 4 )
+		{
+			msg << strfname << ": a channel needs low high [rate [reference tolerance]], not \"" << line << "\"!";
+			ERROR_LOG(filename, __FUNCTION__, msg.str());
+			clear();
+			return false;
+		}
+
+		ll_rate			|= ( values.size() >= 3 );
+		ll_deviation	|= ( values.size() >= 5 );
+		switch ( ll_type )
+		{
+			case ST_UINT8:	add_channel( ll_uint8, values );	break;
+			case ST_INT16:	add_channel( ll_int16, values );	break;
+			case ST_FLOAT:	add_channel( ll_float, values );	break;
+		}
+		ll_channels++;
+	}
+	return true;
+}
+
+
+//======================================================================
+/// @fn clear
+//
+/// @brief removes all channels, the table checks nothing any more
+//
+//======================================================================
+void lm_limits::clear ( void )
+{
+	ll_type			= ST_UINT8;
+	ll_channels		= 0;
+	ll_rate			= false;
+	ll_deviation	= false;
+	ll_uint8		= limit_table<unsigned char>();
+	ll_int16		= limit_table<short>();
+	ll_float		= limit_table<float>();
+}
+
+
+//======================================================================
+/// @fn add_channel
+//
+/// @brief appends a channel to the table. A check without limits in
+///		the file is never violated.
+//
+//======================================================================
+template <typename T>
+void lm_limits::add_channel ( limit_table<T>& table, const std::vector<double>& values )
+{
+	table.low.push_back		( to_sample<T>( values[0] ) );
+	table.high.push_back	( to_sample<T>( values[1] ) );
+	table.rate.push_back	( ( values.size() >= 3 ) ? to_sample<T>( values[2] ) : no_limit<T>() );
+	table.ref.push_back		( ( values.size() >= 5 ) ? to_sample<T>( values[3] ) : T(0) );
+	table.tol.push_back		( ( values.size() >= 5 ) ? to_sample<T>( values[4] ) : no_limit<T>() );
+	table.sample.push_back	( T(0) );
+}
+
+
+//======================================================================
+/// @fn check
+//
+/// @brief checks a dataset against the limits of the channels
+//
+/// @details The samples of the dataset are the channels of the table.
+///		Samples beyond the last channel aren't checked.
+//
+/// @retval number of violated checks
+//
+//======================================================================
+unsigned int lm_limits::check ( const unsigned char* data, unsigned int length, unsigned int slot )
+{
+	switch ( ll_type )
+	{
+		case ST_INT16:	return check_table( ll_int16, data, length, slot );
+		case ST_FLOAT:	return check_table( ll_float, data, length, slot );
+		default:		return check_table( ll_uint8, data, length, slot );
+	}
+}
+
+
+template <typename T>
+unsigned int lm_limits::check_table ( limit_table<T>& table, const unsigned char* data, unsigned int length, unsigned int slot )
+{
+	unsigned int	n			= length / sizeof(T);
+	unsigned int	violations;
+	T				*excess;
+
+	if ( n > ll_channels )
+	{
+		n = ll_channels;
+	}
+	if ( n == 0 )
+	{
+		return 0;
+	}
+	if ( slot >= table.seen.size() )
+	{
+		table.seen.resize	( slot + 1, false );
+		table.prev.resize	( (slot + 1) * ll_channels );
+		table.excess.resize	( (slot + 1) * ll_channels );
+	}
+	excess = &table.excess[slot * ll_channels];
+
+	memcpy( &table.sample[0], data, n * sizeof(T) );
+	violations = lm_kernels::band( &table.sample[0], &table.low[0], &table.high[0], excess, n );
+
+	if ( ll_deviation )
+	{
+		violations += lm_kernels::deviation( &table.sample[0], &table.ref[0], &table.tol[0], excess, n );
+	}
+	if ( ll_rate )
+	{
+		T	*prev = &table.prev[slot * ll_channels];
+
+		if ( table.seen[slot] )
+		{
+			violations += lm_kernels::deviation( &table.sample[0], prev, &table.rate[0], excess, n );
+		}
+		memcpy( prev, &table.sample[0], n * sizeof(T) );
+		table.seen[slot] = true;
+	}
+	return violations;
+}
+
+
+//======================================================================
+/// @fn copy_excess
+//
+/// @brief copies the excess of each channel over its limits, computed by
+///		the last check of the slot, into a buffer. This is the difference 
+///		vector of the result data of LM.
+//
+//======================================================================
+void lm_limits::copy_excess ( unsigned char* data, unsigned int length, unsigned int slot ) const
+{
+	switch ( ll_type )
+	{
+		case ST_INT16:	copy_table( ll_int16, data, length, slot );	break;
+		case ST_FLOAT:	copy_table( ll_float, data, length, slot );	break;
+		default:		copy_table( ll_uint8, data, length, slot );	break;
+	}
+}
+
+
+template <typename T>
+void lm_limits::copy_table ( const limit_table<T>& table, unsigned char* data, unsigned int length, unsigned int slot ) const
+{
+	unsigned int	count	= 0;
+
+	if ( slot < table.seen.size() )
+	{
+		count = ll_channels * sizeof(T);
+		if ( count > length )
+		{
+			count = length;
+		}
+		memcpy( data, &table.excess[slot * ll_channels], count );
+	}
+	memset( data + count, 0, length - count );
+}
+
+
+//======================================================================
+/// @fn channels
+//
+/// @brief returns the number of channels, 0 if no limits file is loaded
+//
+//======================================================================
+unsigned int lm_limits::channels ( void ) const
+{
+	return ll_channels;
+}
+
+
+//======================================================================
+/// @fn rate_checked
+//
+/// @brief returns true if a rate of change limit is configured
+//
+/// @details The verdict of a dataset then depends on the previous data of
+///		its slot too, so that it can't be reused for unchanged data.
+//
+//======================================================================
+bool lm_limits::rate_checked ( void ) const
+{
+	return ll_rate;
+}
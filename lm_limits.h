@@ -0,0 +1,114 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file lm_limits.h
+//
+///  @brief This is the table of limits checked by the lmodel component
+///
+///  @details
+///		The table holds for each channel of a dataset a band (low and high
+///		limit), a rate of change limit and a reference with a tolerance. The 
+///		samples are unsigned 8 bit, signed 16 bit or float values. The checks 
+///		are performed by the kernels of lm_kernels. <br>
+///		The rate of change is checked against the previous data of the same 
+///		slot; each dataset of a sae cycle has its own slot. <br>
+///		A limits file starts with the line "type uint8", "type int16" or
+///		"type float" and has one line per channel: low high [rate [reference 
+///		tolerance]]. Lines starting with '#' are ignored.
+//		
+//==============================================================================
+
+#ifndef __LM_LIMITS_H__
+#define __LM_LIMITS_H__
+
+#include <vector>
+
+class lm_limits
+{
+public:
+
+	enum sample_type
+	{
+		ST_UINT8,																	///< unsigned 8 bit samples
+		ST_INT16,																	///< signed 16 bit samples
+		ST_FLOAT																	///< float samples
+	};
+
+	lm_limits			( void );
+
+	bool load			( const char* file_name										///< limits file name, relative to INPUTDIR
+						);
+
+	unsigned int check	( const unsigned char* data,								///< dataset
+						  unsigned int length,										///< length of the dataset
+						  unsigned int slot											///< slot of the dataset in the sae cycle
+						);
+
+	void copy_excess	( unsigned char* data,										///< destination buffer
+						  unsigned int length,										///< length of the destination buffer, the rest of it is zeroed
+						  unsigned int slot											///< slot of the last checked dataset
+						) const;
+
+	unsigned int channels	( void ) const;
+
+	bool rate_checked	( void ) const;
+
+	void clear			( void );
+
+private:
+
+	/// limits and state of the channels for one sample type
+	template <typename T>
+	struct limit_table
+	{
+		std::vector<T>			low, high, rate, ref, tol;				///< limits of the channels
+		std::vector<T>			sample;									///< samples of the checked dataset
+		std::vector<T>			prev, excess;							///< previous samples and excess of each slot
+		std::vector<bool>		seen;									///< slots with previous samples
+	};
+
+	template <typename T>
+	void add_channel	( limit_table<T>& table, const std::vector<double>& values );
+
+	template <typename T>
+	unsigned int check_table ( limit_table<T>& table, const unsigned char* data, unsigned int length, unsigned int slot );
+
+	template <typename T>
+	void copy_table		( const limit_table<T>& table, unsigned char* data, unsigned int length, unsigned int slot ) const;
+
+	sample_type					ll_type;								///< type of the samples
+	unsigned int				ll_channels;							///< number of channels
+	bool						ll_rate, ll_deviation;					///< rate of change and deviation checks are configured
+	limit_table<unsigned char>	ll_uint8;
+	limit_table<short>			ll_int16;
+	limit_table<float>			ll_float;
+};
+
+#endif /*__LM_LIMITS_H__*/
@@ -36,6 +36,7 @@
 #include "constants.h"
 #include "reporting.h"
 #include "key_functions.h"
+#include "lm_kernels.h"
 
 
 static const char	*filename = "lt_pnode_top.cpp";		///< filename for reporting
@@ -73,7 +74,7 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 						,	unsigned int		cycle_trigger_nr_										///< process cycles interval to trigger the monitor
 						,	unsigned int		infifos_size_											///< size of the fifo channel for incoming sensor data from the files
 						,	unsigned int		outfifos_size_											///< size of the fifo channel for outgoing actuator data
-						,	unsigned int		nodenbr_												///< Position index for the vectoors of events
+						,	const node_options&	options_												///< options of the node
 						):
 	  node_id
 		( ID_
@@ -105,6 +106,18 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		( othernodes_in_number + sensorenv_number)
 	, ic4target_number
 		( othernodes_out_number + actuator_number )
+	, flattened
+		( options_.flattened )
+	, node_mode
+		( options_.mode )
+	, lm_batch
+		( options_.lm_batch )
+	, lm_incremental
+		( options_.lm_incremental )
+	, sae_barrier_timeout
+		( options_.mode == PM_EXECUTOR ? sc_core::SC_ZERO_TIME : options_.sae_barrier_timeout )	// the executor runs the sensors before LM
+	, see_multicast
+		( options_.see_multicast )
 	, ic1initiator_data_length
 		( ic1initiator_data_length_ )
 	, gvoc_monitor_data_length
@@ -174,18 +187,25 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		)
 	, ic1
 		( "IC1"
-		, ic1initiator_number				
+		, (options_.flattened ? 0 : ic1initiator_number)
 		, sae_memory_size
+		, (buswidth1/8)
+		, sae_write_latency
+		, (options_.ic1_coalescing && !options_.flattened)
+		, glob_quantum
 		)
 	, ic2
 		( "IC2"
+		, glob_quantum
 		)
 	, ic3
 		( "IC3"
+		, glob_quantum
 		)
 	, ic4
 		( "IC4"
 		, ic4target_number
+		, glob_quantum
 		)
 	, gvoc
 		( "GVOC"
@@ -195,6 +215,10 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		, gvocsee_nr_dataset_cycle_
 		, gvocm_nr_dataset_cycle_
 		, glob_quantum
+		, node_pool
+		, options_.gvoc_schedule
+		, options_.gvoc_refresh
+		, options_.mode
 		)
 	, lmodel
 		( "LMODEL"
@@ -210,7 +234,13 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		, see_lm_write_latency
 		, cycle_trigger_nr_
 		, glob_quantum
-		, 0
+		, node_events
+		, node_pool
+		, options_.mode
+		, (options_.lm_batch ? ic1initiator_nr_dataset_cycle_ * ic1initiator_number : 0)
+		, options_.lm_limits_file
+		, options_.lm_incremental
+		, sae_barrier_timeout
 		)
 	, sae
 		("SAE"
@@ -219,6 +249,8 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		, (buswidth1/8)
 		, sae_read_latency
 		, sae_write_latency
+		, (options_.flattened ? ic1initiator_number : 0)
+		, sc_core::SC_ZERO_TIME								// IC1 doesn't annotate any delay of its own
 		)
 	, monitor
 		( "MONITOR"
@@ -232,7 +264,10 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		, lm_read_latency
 		, see_report_read_latency
 		, glob_quantum
-		, nodenbr_
+		, node_events
+		, node_pool
+		, options_.mode
+		, options_.monitor_staleness
 		)
 	, see
 		( "SEE"
@@ -250,17 +285,22 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 		, see_lm_write_latency
 		, cycle_trigger_nr_
 		, glob_quantum
-		, 0
+		, node_events
+		, node_pool
+		, options_.mode
+		, options_.see_rules
+		, options_.see_multicast
+		, ic4target_number
 		)
 {
 	//create sensorsenv
-	sensorsenv.init	(sensorenv_number, create_sensor_obj(sensor_id_nr, ic1initiator_data_length, ic1initiator_nr_dataset_cycle_, glob_quantum, infifos_size_)); 
+	sensorsenv.init	(sensorenv_number, create_sensor_obj(sensor_id_nr, ic1initiator_data_length, ic1initiator_nr_dataset_cycle_, glob_quantum, infifos_size_, &node_pool, node_mode)); 
 	
 	//create actuators
 	actuators.init	(actuator_number, create_actuator_obj(act_id_nr, actuator_memory_size, (buswidth4/8), actuator_write_latency, actuator_write_latency, globales_quantum_));
 
 	//create othernodes
-	the_others.init	(othernodes_in_number, create_othernode_obj(othernodes_id_nr, ic1initiator_data_length, ic1initiator_nr_dataset_cycle_, glob_quantum) );	
+	the_others.init	(othernodes_in_number, create_othernode_obj(othernodes_id_nr, ic1initiator_data_length, ic1initiator_nr_dataset_cycle_, glob_quantum, &node_pool, node_mode) );	
 
 	//create othernodes
 	extactions.init	(othernodes_out_number, create_extaction_obj(extaction_id_nr, extaction_memory_size, (buswidth4/8), extaction_write_latency, extaction_write_latency) );	
@@ -271,21 +311,65 @@ lt_pnode_top::lt_pnode_top(	sc_module_name		name_													///< sc module nam
 	othernodes_inports.init(othernodes_in_number);
 	node_outfifos.init(othernodes_out_number);
 
-	SC_THREAD(pn_thread);
+	//recording of the traffic to the other nodes
+	if (options_.record_traffic && node_recorder.open(name()))
+	{
+		for (int i = 0; i < othernodes_out_number; i++)
+		{
+			node_outfifos[i].set_recorder(&node_recorder, i);
+		}
+	}
 
-	//bindings-operations
-	//binds initiator socket of each sensor to the target socket of a ic1
-	for (int i= 0; i<sensorenv_number; i++)
+	//dirty tracking of the sensor datasets on the sae
+	if (options_.lm_incremental)
+	{
+		sae.track_dirty(ic1initiator_data_length);
+	}
+
+	//completion barrier of the sae cycles for LM
+	if (sae_barrier_timeout != sc_core::SC_ZERO_TIME)
 	{
-		sensorsenv[i].s_isocket.bind( ic1.ic1_tsocket_array[i] );
+		sae.track_cycles(node_events, ic1initiator_number);
 	}
 
-	for (int i= 0; i<othernodes_in_number; i++)
+	if (node_mode == PM_EXECUTOR)
+	{
+		SC_THREAD(executor_thread);
+	}
+	else
 	{
-		the_others[i].on_isocket.bind( ic1.ic1_tsocket_array[i+sensorenv_number] );
+		SC_THREAD(pn_thread);
 	}
 
-	//binds initiator socket of ic1 to the target socket of t1
+	//bindings-operations
+	if (flattened)
+	{
+		//binds initiator socket of each sensor directly to its target socket of the sae
+		for (int i= 0; i<sensorenv_number; i++)
+		{
+			sensorsenv[i].s_isocket.bind( sae.sae_direct_tsocket_array[i] );
+		}
+
+		for (int i= 0; i<othernodes_in_number; i++)
+		{
+			the_others[i].on_isocket.bind( sae.sae_direct_tsocket_array[i+sensorenv_number] );
+		}
+	}
+	else
+	{
+		//binds initiator socket of each sensor to the target socket of a ic1
+		for (int i= 0; i<sensorenv_number; i++)
+		{
+			sensorsenv[i].s_isocket.bind( ic1.ic1_tsocket_array[i] );
+		}
+
+		for (int i= 0; i<othernodes_in_number; i++)
+		{
+			the_others[i].on_isocket.bind( ic1.ic1_tsocket_array[i+sensorenv_number] );
+		}
+	}
+
+	//binds initiator socket of ic1 to the target socket of t1 (idle in the flattened topology)
 	ic1.ic1_isocket.bind	( sae.sae_tsocket_array[0]	);
 
 	//binds initiator socket of gvoc to the target socket of monitor
@@ -381,6 +465,166 @@ void lt_pnode_top::pn_thread(void)
 }
 
 
+//======================================================================
+/// @fn executor_thread
+//
+/// @brief Executor of the process cycle of a node (node_options::mode PM_EXECUTOR).
+//
+/// @details It replaces the threads of the components and runs the processes
+///		of a quantum in their order in the process cycle: A1 and A2, B for each
+///		sensor and other node, then C1 with the processes it triggers, until
+///		each of them has consumed the quantum. Then it synchronizes once, as F,
+///		with the quantum keeper of the node. <br>
+///		The quantum keepers of the components still hold the local time of each
+///		process, so that every transaction is annotated with the same delay as
+///		with the threads. The start delays of the threads in the first quantum 
+///		become local time offsets. A process which is still in its synchronization
+///		doesn't react to the notifications of the other ones, like its thread. <br>
+///		After each synchronization, it waits one delta cycle, so that the data
+///		written into the input fifos at the start of the quantum is readable by B.
+///		In the coalescing mode of IC1, the writes staged by B are committed 
+///		before C1, since the commit method of IC1 would only run after C1.
+///		So C1 reads all the sensor data of the quantum, whereas its thread
+///		reads at its time in the quantum, between the commits of the sensors
+///		which have already written and of those which haven't.
+//
+/// @see lt_pnode_top::execute_lm_cycle()
+//======================================================================
+void lt_pnode_top::executor_thread(void)
+{
+	sc_core::sc_time	start;
+
+	wait ( sc_core::SC_ZERO_TIME );										// the input fifos are filled in the first delta cycle
+
+	// start delays of the threads
+	gvoc.get_see_qk().set			( sc_core::sc_time(0.1, node_time_unit) );
+	for (int i = 0; i < sensorenv_number; i++)
+	{
+		sensorsenv[i].get_qk().set	( sc_core::sc_time(0.2, node_time_unit) );
+	}
+	for (int i = 0; i < othernodes_in_number; i++)
+	{
+		the_others[i].get_qk().set	( sc_core::sc_time(0.3, node_time_unit) );
+	}
+	lmodel.get_sae_qk().set			( sc_core::sc_time(0.4, node_time_unit) );
+
+	while(true)
+	{
+		start = sc_core::sc_time_stamp();
+
+		while ( !gvoc.get_monitor_qk().need_sync() )					// A1
+		{
+			gvoc.gvoc_monitor_transfer();
+		}
+		while ( !gvoc.get_see_qk().need_sync() )						// A2
+		{
+			gvoc.gvoc_see_transfer();
+		}
+		for (int i = 0; i < sensorenv_number; i++)						// B
+		{
+			while ( !sensorsenv[i].get_qk().need_sync() )
+			{
+				sensorsenv[i].sensor_transfer();
+			}
+		}
+		for (int i = 0; i < othernodes_in_number; i++)
+		{
+			while ( !the_others[i].get_qk().need_sync() )
+			{
+				the_others[i].on_transfer();
+			}
+		}
+		ic1.commit_method();											// the writes staged by B are committed before C1 reads them
+		while ( !lmodel.get_sae_qk().need_sync() )						// C1 ... E2
+		{
+			execute_lm_cycle();
+		}
+
+		node_delay = glob_quantum;										// F
+		node_qk.set( node_delay );
+		trtr::follow_synch(filename, name(), "NODE", node_id, node_delay, trtr::S_NEED);
+		node_qk.sync();
+		trtr::follow_synch(filename, name(), "NODE", node_id, node_delay, trtr::S_RETURN);
+		wait ( sc_core::SC_ZERO_TIME );									// the input fifos are refilled in the delta cycle of the synchronization
+
+		restart_qk( gvoc.get_monitor_qk(), start );
+		restart_qk( gvoc.get_see_qk(), start );
+		for (int i = 0; i < sensorenv_number; i++)
+		{
+			restart_qk( sensorsenv[i].get_qk(), start );
+		}
+		for (int i = 0; i < othernodes_in_number; i++)
+		{
+			restart_qk( the_others[i].get_qk(), start );
+		}
+		restart_qk( lmodel.get_sae_qk(), start );
+		restart_qk( lmodel.get_see_qk(), start );
+		restart_qk( see.get_qk(), start );
+		restart_qk( monitor.get_lm_qk(), start );
+		restart_qk( monitor.get_see_qk(), start );
+	}
+}
+
+
+//======================================================================
+/// @fn execute_lm_cycle
+//
+/// @brief runs one transfer of C1 and the processes it triggers.
+//
+/// @details C1 triggers either E1, which triggers C2, or C2 directly. C2
+///		triggers D, which triggers E2 every cycle_trigger_nr_ process cycles.
+///		A triggered process runs only if it hasn't yet consumed the quantum.
+//======================================================================
+void lt_pnode_top::execute_lm_cycle(void)
+{
+	bool	c2_triggered	= true;
+
+	if ( lmodel.lmodel_sae_transfer() )									// C1
+	{
+		c2_triggered = !monitor.get_lm_qk().need_sync();
+		if ( c2_triggered )
+		{
+			monitor.monitor_lm_transfer();								// E1
+		}
+	}
+
+	if ( c2_triggered && !lmodel.get_see_qk().need_sync() )
+	{
+		lmodel.lmodel_see_transfer();									// C2
+
+		if ( !see.get_qk().need_sync() && see.see_transfer() )			// D
+		{
+			if ( !monitor.get_see_qk().need_sync() )
+			{
+				monitor.monitor_see_transfer();							// E2
+			}
+		}
+	}
+}
+
+
+//======================================================================
+/// @fn restart_qk
+//
+/// @brief resets the quantum keeper of a process after the synchronization
+///		of the executor.
+//
+/// @details A local time beyond the end of the quantum is kept as offset in
+///		the new quantum, where the thread would have resumed.
+//======================================================================
+void lt_pnode_top::restart_qk(	tlm_utils::tlm_quantumkeeper	&qk,
+								const sc_core::sc_time			&start	)
+{
+	sc_core::sc_time	end	= start + qk.get_local_time();
+
+	qk.reset();
+	if ( end > sc_core::sc_time_stamp() )
+	{
+		qk.set( end - sc_core::sc_time_stamp() );
+	}
+}
+
+
 //======================================================================
 /// @fn print_keyparameters
 //
@@ -395,7 +639,13 @@ void lt_pnode_top::print_keyparameters(void)
 
 	msg.str("");
 	msg << "\t Node Name					:	" << name()<< endl
-		<< "\t GLOBAL QUANTUM				=	" << glob_quantum				<< endl << endl
+		<< "\t GLOBAL QUANTUM				=	" << glob_quantum				<< endl
+		<< "\t TOPOLOGY					:	" << (flattened ? "FLATTENED" : "ROUTED") << endl
+		<< "\t PROCESSES					:	" << (node_mode == PM_EXECUTOR ? "EXECUTOR" : (node_mode == PM_METHOD ? "METHODS" : "THREADS")) << endl
+		<< "\t LM EVALUATION				:	" << (lm_batch ? "BATCH" : "DATASET") << (lm_incremental ? ", INCREMENTAL" : "") << endl
+		<< "\t SAE BARRIER TIMEOUT		=	" << sae_barrier_timeout		<< endl
+		<< "\t SEE DELIVERY				:	" << (see_multicast == MC_SCATTER ? "SCATTER" : (see_multicast == MC_BROADCAST ? "BROADCAST" : "UNICAST")) << endl
+		<< "\t LM KERNELS					:	" << lm_kernels::isa_name(lm_kernels::get_isa()) << endl << endl
 
 		<< "\t MONITOR-GVOC WRITE LATENCY	=	" << monitor_write_latency		<< endl
 		<< "\t SEE-GVOC WRITE LATENCY		=	" << see_gvoc_write_latency		<< endl
@@ -58,12 +58,39 @@
 #include "interconnect2.h"
 #include "interconnect3.h"
 #include "interconnect4.h"
+#include "block_fifo.h"
+#include "traffic_log.h"
 #include "bridge_lmodel.h"
 #include "bridge_monitor.h"
 #include "bridge_see.h"
+#include "payload_pool.h"
 #include "constants.h"
 
 
+//options of a node, all of them off by default
+struct node_options
+{
+	bool				ic1_coalescing		;				///< coalesces the sensor writes in IC1 to one burst per quantum
+	bool				flattened			;				///< binds the sensor initiators directly to the sae instead of routing them through IC1
+	bool				record_traffic		;				///< records the bytes written into the output fifos for a later replay
+	const char*			gvoc_schedule		;				///< schedule file of the gvoc data, 0 for the default record
+	sc_core::sc_time	gvoc_refresh		;				///< interval to resend an unchanged gvoc record, SC_ZERO_TIME to send only changes
+	process_mode		mode				;				///< implementation of the processes: threads, bridge methods or one executor thread
+	bool				lm_batch			;				///< LM reads and evaluates the sensor data of a whole sae cycle at once
+	const char*			lm_limits_file		;				///< limits file of the sensor channels checked by LM, 0 without limit checking
+	bool				lm_incremental		;				///< LM evaluates only the sensor datasets changed since their last evaluation
+	const char*			see_rules			;				///< rule file of the decision table of the see, 0 without decision table
+	sc_core::sc_time	monitor_staleness	;				///< the monitor reads only changed reports or reports older than this, SC_ZERO_TIME to read at every trigger
+	sc_core::sc_time	sae_barrier_timeout	;				///< LM waits for the completion of each sae cycle, at most this long, SC_ZERO_TIME to read it without barrier
+	multicast_mode		see_multicast		;				///< the see delivers its decision, or a slice of it, to all actuators and extactions in one transaction
+
+	node_options()	: ic1_coalescing(false), flattened(false), record_traffic(false)
+					, gvoc_schedule(0), gvoc_refresh(sc_core::SC_ZERO_TIME), mode(PM_THREAD)
+					, lm_batch(false), lm_limits_file(0), lm_incremental(false), see_rules(0)
+					, monitor_staleness(sc_core::SC_ZERO_TIME), sae_barrier_timeout(sc_core::SC_ZERO_TIME), see_multicast(MC_NONE) {}
+};
+
+
 class lt_pnode_top: public sc_module
 {
 public:
@@ -90,15 +117,20 @@ public:
 				,	unsigned int		cycle_trigger_nr_										///< process cycles interval to trigger the monitor
 				,	unsigned int		infifos_size_											///< size of the fifo channel for incoming sensor data from the files
 				,	unsigned int		outfifos_size_											///< size of the fifo channel for outgoing actuator data
-				,	unsigned int		nodenbr_												///< Position index for the vectoors of events
+				,	const node_options&	options_ = node_options()									///< options of the node, their defaults keep the baseline model
 				);
 
 public:
 	SC_HAS_PROCESS(lt_pnode_top);
 
 	void pn_thread( void )								;
+	void executor_thread( void )						;
 	void print_keyparameters(void)						; 
 
+private:
+	void execute_lm_cycle( void )						;
+	void restart_qk( tlm_utils::tlm_quantumkeeper &qk, const sc_core::sc_time &start );
+
 private:
 	unsigned int			node_id						;
 
@@ -109,6 +141,12 @@ private:
 	unsigned int			actuator_number				;
 	unsigned int			ic1initiator_number			;
 	unsigned int			ic4target_number			;
+	bool					flattened					;
+	process_mode			node_mode					;
+	bool					lm_batch					;
+	bool					lm_incremental				;
+	sc_core::sc_time		sae_barrier_timeout			;
+	multicast_mode			see_multicast				;
 
 	//datenlnge im Modell
 	unsigned int			ic1initiator_data_length	;
@@ -145,6 +183,12 @@ private:
 	unsigned int			see_lmmemory_size			;
 	unsigned int			see_gvocmemory_size			;
 
+	//transaction objects
+	payload_pool			node_pool					;
+
+	//recording of the traffic to the other nodes
+	traffic_recorder		node_recorder				;
+
 	initiator_gvoc			gvoc						;
 	sc_core::sc_vector<initiator_sensorenv> sensorsenv	;
 	sc_core::sc_vector<initiator_othernode> the_others	;
@@ -155,6 +199,9 @@ private:
 	interconnect2			ic2							;
 	interconnect3			ic3							;
 	interconnect4			ic4							;
+	//events of the process cycle of this node
+	node_sync				node_events					;
+
 	bridge_lmodel			lmodel						;
 	bridge_monitor			monitor						;
 	bridge_see				see							;
@@ -162,13 +209,13 @@ private:
 
 public:
 	//For Data from sensors and environment
-	sc_core::sc_vector< sc_core::sc_fifo< datyp > >									node_infifos		;
+	sc_core::sc_vector< block_fifo< datyp > >										node_infifos		;
 
 	//For Data to other nodes 
-	sc_core::sc_vector< sc_core::sc_fifo< sc_dt::uchar> >							node_outfifos		;
+	sc_core::sc_vector< recording_fifo >											node_outfifos		;
 
 	//For Data from other nodes
-	sc_core::sc_vector< sc_core::sc_port< sc_core::sc_fifo_in_if<sc_dt::uchar> >  >	othernodes_inports	;
+	sc_core::sc_vector< sc_core::sc_port< message_fifo_in_if >  >					othernodes_inports	;
 
 	//======================================================================
 	/// @struct create_sensor_obj
@@ -178,15 +225,17 @@ public:
 	//======================================================================
 	struct create_sensor_obj
 	{
-		create_sensor_obj(unsigned int id, unsigned int dl, unsigned int dset_nr, sc_core::sc_time gq, unsigned int fs)
-			:cid(id), clength(dl), cgq(gq), cds_nr(dset_nr), cfs(fs){}
+		create_sensor_obj(unsigned int id, unsigned int dl, unsigned int dset_nr, sc_core::sc_time gq, unsigned int fs, payload_pool* pool, process_mode mode)
+			:cid(id), clength(dl), cgq(gq), cds_nr(dset_nr), cfs(fs), cpool(pool), cmode(mode){}
 
 		initiator_sensorenv* operator()(const char* name, size_t)
 		{
-			return new initiator_sensorenv(name, cid, clength, cds_nr, cgq, cfs);
+			return new initiator_sensorenv(name, cid, clength, cds_nr, cgq, cfs, *cpool, cmode);
 		}
 		unsigned int cid, clength, cds_nr, cfs	;
 		sc_core::sc_time cgq					;
+		payload_pool *cpool						;
+		process_mode cmode						;
 	};
 
 //======================================================================
@@ -216,15 +265,17 @@ public:
 //======================================================================
 	struct create_othernode_obj
 	{
-		create_othernode_obj(unsigned int id, unsigned int dl, unsigned int dset_nr,  sc_core::sc_time gquantum)
-			:cid(id), csize(dl), cquantum(gquantum), cds_nr(dset_nr){}
+		create_othernode_obj(unsigned int id, unsigned int dl, unsigned int dset_nr,  sc_core::sc_time gquantum, payload_pool* pool, process_mode mode)
+			:cid(id), csize(dl), cquantum(gquantum), cds_nr(dset_nr), cpool(pool), cmode(mode){}
 
 		initiator_othernode* operator()(const char* name, size_t)
 		{
-			return new initiator_othernode(name, cid, csize, cds_nr , cquantum);
+			return new initiator_othernode(name, cid, csize, cds_nr , cquantum, *cpool, cmode);
 		}
 		unsigned int cid, csize, cds_nr	;
 		sc_core::sc_time cquantum		;
+		payload_pool *cpool				;
+		process_mode cmode				;
 	};
 
 
@@ -258,9 +309,9 @@ public:
 		create_fifo_obj(int size)
 			:csize(size){}
 
-		sc_fifo<datyp>* operator()(const char* name, size_t)
+		block_fifo<datyp>* operator()(const char* name, size_t)
 		{
-			return new sc_fifo<datyp>(name, csize);
+			return new block_fifo<datyp>(name, csize);
 		}
 		int csize;
 	};
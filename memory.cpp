@@ -27,9 +27,12 @@
 *    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+
 #include "memory.h"
 #include "reporting.h"
 #include "constants.h"
+#include "dirty_extension.h"
 
 static const char *filename = "memory.cpp";
 
@@ -54,6 +57,8 @@ memory::memory
 , m_write_delay     (write_delay	)
 , m_memory_size     (memory_size	)
 , m_memory_width    (memory_width	)
+, m_slot_size		(0				)
+, m_version			(0				)
 { 
 ///verify the size of the memory	
 
@@ -125,6 +130,7 @@ bool memory::operation	( unsigned int id,							///< initiator ID
 	{
 		if (response_status == tlm::TLM_OK_RESPONSE)
 		{
+			note_write( address, data, length );
 			memcpy( (m_memory+address), data, size_t(length) );
 		}
 		delay = delay + m_write_delay*burst_length;
@@ -139,6 +145,7 @@ bool memory::operation	( unsigned int id,							///< initiator ID
 		{
 
 			memcpy(data, m_memory+address, size_t(length));
+			consume_dirty( tObj );
 		}
 		delay = delay + m_read_delay*burst_length;
 		break;
@@ -155,6 +162,59 @@ bool memory::operation	( unsigned int id,							///< initiator ID
 }// end memory_operation
 
 
+//==============================================================================
+///  @fn memory::debug_operation
+//  
+///  @brief performs read's and write's on the memory for the debug transport
+///		interface.
+// 
+///  @details 
+///		Unlike memory::operation(), it doesn't annotate any delay, doesn't
+///		check the byte enables and the streaming width and doesn't report the
+///		memory access. An access crossing the end of the memory is truncated.
+//
+///  @retval number of bytes actually read or written
+//
+///	@see memory::operation()
+//
+//==============================================================================
+unsigned int memory::debug_operation	( tlm::tlm_generic_payload& tObj	///< ref to transaction object 
+										)
+{
+	sc_dt::uint64    address	=	tObj.get_address();			// memory address
+	tlm::tlm_command command	=	tObj.get_command();			// memory command
+	unsigned char    *data		=	tObj.get_data_ptr();		// data pointer
+	unsigned  int    length		=	tObj.get_data_length();		// data length
+
+	if ( address >= m_memory_size )
+	{
+		return 0;
+	}
+	if ( (address + length) > m_memory_size )
+	{
+		length = (unsigned int)(m_memory_size - address);
+	}
+
+	switch (command)
+	{
+	case tlm::TLM_WRITE_COMMAND:
+		note_write( address, data, length );
+		memcpy( (m_memory+address), data, size_t(length) );
+		break;
+
+	case tlm::TLM_READ_COMMAND:
+		memcpy( data, (m_memory+address), size_t(length) );
+		break;
+
+	default:
+		length = 0;
+		break;
+	}
+
+	return length;
+}
+
+
 //==============================================================================
 ///  @fn memory::check_address
 //  
@@ -227,6 +287,101 @@ unsigned char* memory::get_mem_ptr(void)
 }
 
 
+//==============================================================================
+///  @fn memory::track_dirty
+//  
+///  @brief enables the dirty tracking of the memory
+//
+///  @details
+///		The memory is divided in slots of slot_size bytes with a dirty flag each.
+///		A write which changes the content of a slot sets its flag. A read carrying 
+///		a dirty_extension returns the flags of the slots it covers and clears 
+///		them. At first all slots are dirty.
+//
+///	 @see dirty_extension
+//   
+//==============================================================================
+void memory::track_dirty( unsigned int slot_size )
+{
+	m_slot_size = slot_size;
+	m_dirty.assign( ( slot_size > 0 ) ? size_t( (m_memory_size + slot_size - 1) / slot_size ) : 0, true );
+}
+
+
+//==============================================================================
+///  @fn memory::note_write
+//  
+///  @brief counts a write which changes the content of the memory in the
+///		version and marks the changed slots dirty, before the data is written
+//   
+//==============================================================================
+void memory::note_write( sc_dt::uint64 address, const unsigned char *data, unsigned int length )
+{
+	if ( memcmp( m_memory + address, data, length ) == 0 )
+	{
+		return;
+	}
+	m_version++;
+	mark_dirty( address, data, length );
+}
+
+
+//==============================================================================
+///  @fn memory::mark_dirty
+//  
+///  @brief sets the dirty flag of each slot whose content is changed by a write,
+///		before the data is written
+//   
+//==============================================================================
+void memory::mark_dirty( sc_dt::uint64 address, const unsigned char *data, unsigned int length )
+{
+	sc_dt::uint64	end		= address + length;
+
+	if ( m_slot_size == 0 )
+	{
+		return;
+	}
+	while ( address < end )
+	{
+		sc_dt::uint64	slot		= address / m_slot_size;
+		sc_dt::uint64	slot_end	= (slot + 1) * m_slot_size;
+		unsigned int	count		= (unsigned int)( ( slot_end < end ? slot_end : end ) - address );
+
+		if ( !m_dirty[size_t(slot)] && memcmp( m_memory + address, data, count ) != 0 )
+		{
+			m_dirty[size_t(slot)] = true;
+		}
+		address	+= count;
+		data	+= count;
+	}
+}
+
+
+//==============================================================================
+///  @fn memory::consume_dirty
+//  
+///  @brief returns the dirty flags of the slots covered by a read in its 
+///		dirty_extension and clears them
+//   
+//==============================================================================
+void memory::consume_dirty( tlm::tlm_generic_payload& tObj )
+{
+	dirty_extension		*ext;
+	sc_dt::uint64		first, last;
+
+	tObj.get_extension( ext );
+	if ( ext == 0 || m_slot_size == 0 || tObj.get_data_length() == 0 )
+	{
+		return;
+	}
+
+	first	= tObj.get_address() / m_slot_size;
+	last	= ( tObj.get_address() + tObj.get_data_length() - 1 ) / m_slot_size;
+	ext->de_dirty.assign( m_dirty.begin() + size_t(first), m_dirty.begin() + size_t(last + 1) );
+	std::fill( m_dirty.begin() + size_t(first), m_dirty.begin() + size_t(last + 1), false );
+}
+
+
 //==============================================================================
 ///  @fn memory::self_write
 //  
@@ -247,6 +402,7 @@ void memory::self_write	( const sc_dt::uchar &adr											///< const ref to st
 	if ( response_status == tlm::TLM_OK_RESPONSE)
 	{
 		sc_dt::uchar address = adr;
+		note_write(adr, source_array, data_length);
 		for (int i = 0 ; i < data_length; i++)
 		{
 			m_memory[address++] = source_array[i];
@@ -39,6 +39,7 @@
 
 #include <systemc.h>
 #include <tlm.h>
+#include <vector>
 
 class memory
 {
@@ -56,6 +57,11 @@ public:
 
 	unsigned char* get_mem_ptr(void);
 
+	void track_dirty( unsigned int slot_size									///< size of a dirty tracked slot (bytes)
+					);
+
+	/// number of writes which changed the content of the memory
+	unsigned int get_version(void) const		{ return m_version; }
 
 
 	bool operation	(	unsigned int id,												///< intiator component ID
@@ -63,6 +69,9 @@ public:
 						sc_core::sc_time& delay_time									///< ref to time delay
 					);	
 
+	unsigned int debug_operation	(	tlm::tlm_generic_payload& tObj							///< ref to transaction object 
+									);
+
 	void self_write	( const sc_dt::uchar &adr											///< const ref to start address			
 					, unsigned char *source_array										///< pointer to the data source array	
 					, const unsigned int &data_length									///< const ref to data length
@@ -90,5 +99,12 @@ private:
    sc_core::sc_time      m_read_delay;            ///< read delay
    sc_core::sc_time      m_write_delay;           ///< write delay
    unsigned char         *m_memory;               ///< memory
+   unsigned int          m_slot_size;             ///< size of a dirty tracked slot, 0 without dirty tracking
+   std::vector<bool>     m_dirty;                 ///< dirty flag of each slot
+   unsigned int          m_version;               ///< number of writes which changed the content
+
+   void note_write	( sc_dt::uint64 address, const unsigned char *data, unsigned int length );
+   void mark_dirty	( sc_dt::uint64 address, const unsigned char *data, unsigned int length );
+   void consume_dirty	( tlm::tlm_generic_payload& tObj );
 };
 #endif /*__MEMORY_H__*/
\ No newline at end of file
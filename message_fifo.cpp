@@ -0,0 +1,301 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "message_fifo.h"
+#include "reporting.h"
+
+static const char			*filename	= "message_fifo.cpp";			///< filename for reporting
+static const unsigned int	prefix_size	= 4;							///< size of the length prefix of a message (bytes)
+
+
+//======================================================================
+/// @fn message_fifo
+//
+/// @brief constructor
+//
+//======================================================================
+message_fifo::message_fifo ( const char* name_, unsigned int size_ )
+	: sc_core::sc_prim_channel( name_ )
+	, mf_buf			( size_ )
+	, mf_size			( size_ )
+	, mf_ri				( 0 )
+	, mf_wi				( 0 )
+	, mf_bytes_readable	( 0 )
+	, mf_msgs_readable	( 0 )
+	, mf_bytes_read		( 0 )
+	, mf_msgs_read		( 0 )
+	, mf_bytes_written	( 0 )
+	, mf_msgs_written	( 0 )
+	, mf_update_pending	( false )
+{
+}
+
+
+//======================================================================
+/// @fn read_msg
+//
+/// @brief waits for a message and reads it
+//
+//======================================================================
+unsigned int message_fifo::read_msg ( sc_dt::uchar* data, unsigned int max_length )
+{
+	unsigned int	length	= 0;
+
+	while ( !nb_read_msg(data, max_length, length) )
+	{
+		sc_core::wait( mf_written_event );
+	}
+	return length;
+}
+
+
+//======================================================================
+/// @fn nb_read_msg
+//
+/// @brief reads the next message if there is one
+//
+/// @details Only max_length bytes are copied, the rest of the message is 
+///		dropped. length is set to the length of the whole message.
+//
+//======================================================================
+bool message_fifo::nb_read_msg ( sc_dt::uchar* data, unsigned int max_length, unsigned int& length )
+{
+	sc_dt::uchar	prefix[prefix_size];
+	unsigned int	copied;
+
+	if ( num_messages() == 0 )
+	{
+		return false;
+	}
+
+	copy_out( prefix, prefix_size );
+	length	= prefix[0] | (prefix[1] << 8) | (prefix[2] << 16) | (unsigned int)(prefix[3] << 24);
+	copied	= std::min( length, max_length );
+	copy_out( data, copied );
+	mf_ri	= ( mf_ri + (length - copied) ) % mf_size;				// dropped bytes
+
+	mf_bytes_read	+= prefix_size + length;
+	mf_msgs_read	+= 1;
+	request_update_once();
+	return true;
+}
+
+
+//======================================================================
+/// @fn nb_read_msgs
+//
+/// @brief reads up to max_count messages in one call
+//
+/// @details Message i is copied to data + i * stride and the rest of its
+///		slot is zeroed.
+//
+/// @retval number of messages read
+//
+//======================================================================
+unsigned int message_fifo::nb_read_msgs ( sc_dt::uchar* data, unsigned int max_count, unsigned int stride )
+{
+	unsigned int	count	= 0;
+	unsigned int	length;
+
+	while ( count < max_count && nb_read_msg(data + count * stride, stride, length) )
+	{
+		if ( length < stride )
+		{
+			memset( data + count * stride + length, 0, stride - length );
+		}
+		count++;
+	}
+	return count;
+}
+
+
+unsigned int message_fifo::num_messages ( void ) const
+{
+	return mf_msgs_readable - mf_msgs_read;
+}
+
+
+const sc_core::sc_event& message_fifo::message_written_event ( void ) const
+{
+	return mf_written_event;
+}
+
+
+//======================================================================
+/// @fn write_msg
+//
+/// @brief waits for enough space and writes a message
+//
+/// @details A message which is larger than the whole channel can never be
+///		written: it is reported as an error instead of waiting forever.
+//
+//======================================================================
+void message_fifo::write_msg ( const sc_dt::uchar* data, unsigned int length )
+{
+	std::ostringstream	msg;
+
+	if ( length > mf_size || mf_size - length < prefix_size )
+	{
+		msg << "\t " << name() << ": message of " << length << " bytes exceeds the capacity of " 
+			<< mf_size << " bytes (length prefix included)!";
+		ERROR_LOG(filename, __FUNCTION__ , msg.str());
+		return;
+	}
+	while ( !nb_write_msg(data, length) )
+	{
+		sc_core::wait( mf_read_event );
+	}
+}
+
+
+//======================================================================
+/// @fn nb_write_msg
+//
+/// @brief writes a message with its length prefix
+//
+/// @retval false if there isn't enough space for the whole message
+//
+//======================================================================
+bool message_fifo::nb_write_msg ( const sc_dt::uchar* data, unsigned int length )
+{
+	sc_dt::uchar	prefix[prefix_size];
+
+	if ( num_free_bytes() < prefix_size + length || prefix_size + length > mf_size )
+	{
+		return false;
+	}
+
+	prefix[0]	= sc_dt::uchar( length		 );
+	prefix[1]	= sc_dt::uchar( length >> 8	 );
+	prefix[2]	= sc_dt::uchar( length >> 16 );
+	prefix[3]	= sc_dt::uchar( length >> 24 );
+	copy_in( prefix, prefix_size );
+	copy_in( data, length );
+
+	mf_bytes_written	+= prefix_size + length;
+	mf_msgs_written		+= 1;
+	request_update_once();
+	return true;
+}
+
+
+unsigned int message_fifo::num_free_bytes ( void ) const
+{
+	return mf_size - mf_bytes_readable - mf_bytes_written;
+}
+
+
+const sc_core::sc_event& message_fifo::message_read_event ( void ) const
+{
+	return mf_read_event;
+}
+
+
+const char* message_fifo::kind ( void ) const
+{
+	return "message_fifo";
+}
+
+
+//======================================================================
+/// @fn update
+//
+/// @brief makes the messages written in this delta cycle readable and 
+///		notifies the events once for all the transfers of the delta cycle
+//
+//======================================================================
+void message_fifo::update ( void )
+{
+	if ( mf_msgs_read > 0 )
+	{
+		mf_read_event.notify( sc_core::SC_ZERO_TIME );
+	}
+	if ( mf_msgs_written > 0 )
+	{
+		mf_written_event.notify( sc_core::SC_ZERO_TIME );
+	}
+	mf_bytes_readable	= mf_bytes_readable - mf_bytes_read + mf_bytes_written;
+	mf_msgs_readable	= mf_msgs_readable - mf_msgs_read + mf_msgs_written;
+	mf_bytes_read		= mf_msgs_read		= 0;
+	mf_bytes_written	= mf_msgs_written	= 0;
+	mf_update_pending	= false;
+}
+
+
+//======================================================================
+/// @fn copy_in
+//
+/// @brief copies bytes at the write position of the ring
+//
+//======================================================================
+void message_fifo::copy_in ( const sc_dt::uchar* src, unsigned int count )
+{
+	unsigned int	first	= std::min( count, mf_size - mf_wi );
+
+	if ( count == 0 )
+	{
+		return;
+	}
+	memcpy( &mf_buf[mf_wi], src, first );
+	memcpy( &mf_buf[0], src + first, count - first );
+	mf_wi = ( mf_wi + count ) % mf_size;
+}
+
+
+//======================================================================
+/// @fn copy_out
+//
+/// @brief copies bytes from the read position of the ring
+//
+//======================================================================
+void message_fifo::copy_out ( sc_dt::uchar* dst, unsigned int count )
+{
+	unsigned int	first	= std::min( count, mf_size - mf_ri );
+
+	if ( count == 0 )
+	{
+		return;
+	}
+	memcpy( dst, &mf_buf[mf_ri], first );
+	memcpy( dst + first, &mf_buf[0], count - first );
+	mf_ri = ( mf_ri + count ) % mf_size;
+}
+
+
+void message_fifo::request_update_once ( void )
+{
+	if ( !mf_update_pending )
+	{
+		mf_update_pending = true;
+		request_update();
+	}
+}
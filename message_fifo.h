@@ -0,0 +1,164 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file message_fifo.h
+//
+///  @brief This is the message oriented fifo channel between the nodes
+//
+///  @details
+///		The channel transfers whole messages instead of single bytes. Each message 
+///		is stored in a fixed capacity ring buffer behind a 4 bytes length prefix.
+///		A message is written and read in one call, and several complete messages
+///		can be read at once with nb_read_msgs(). <br>
+///		It has the same delta cycle semantic as sc_fifo: the messages written 
+///		become readable after the update phase, and the events are notified at 
+///		most once per delta cycle.
+//		
+//==============================================================================
+
+#ifndef __MESSAGE_FIFO_H__
+#define __MESSAGE_FIFO_H__
+
+#include <systemc.h>
+#include <vector>
+
+#include "constants.h"
+
+
+//======================================================================
+/// @class message_fifo_in_if
+//
+/// @brief input interface of the message fifo
+//
+//======================================================================
+class message_fifo_in_if : virtual public sc_core::sc_interface
+{
+public:
+	/// blocking read of a message, returns its length
+	virtual unsigned int read_msg		( sc_dt::uchar* data, unsigned int max_length ) = 0;
+
+	/// non-blocking read of a message, the bytes beyond max_length are dropped
+	virtual bool nb_read_msg			( sc_dt::uchar* data, unsigned int max_length, unsigned int& length ) = 0;
+
+	/// non-blocking read of up to max_count messages, each one in a zero padded slot of stride bytes
+	virtual unsigned int nb_read_msgs	( sc_dt::uchar* data, unsigned int max_count, unsigned int stride ) = 0;
+
+	/// number of readable messages
+	virtual unsigned int num_messages	( void ) const = 0;
+
+	virtual const sc_core::sc_event& message_written_event	( void ) const = 0;
+};
+
+
+//======================================================================
+/// @class message_fifo_out_if
+//
+/// @brief output interface of the message fifo
+//
+//======================================================================
+class message_fifo_out_if : virtual public sc_core::sc_interface
+{
+public:
+	/// blocking write of a message
+	virtual void write_msg		( const sc_dt::uchar* data, unsigned int length ) = 0;
+
+	/// non-blocking write of a message, false if there isn't enough space for it
+	virtual bool nb_write_msg	( const sc_dt::uchar* data, unsigned int length ) = 0;
+
+	/// number of free bytes, length prefixes included
+	virtual unsigned int num_free_bytes	( void ) const = 0;
+
+	virtual const sc_core::sc_event& message_read_event	( void ) const = 0;
+};
+
+
+//======================================================================
+/// @class message_fifo
+//
+/// @brief message oriented fifo channel
+//
+//======================================================================
+class message_fifo	: public message_fifo_in_if
+					, public message_fifo_out_if
+					, public sc_core::sc_prim_channel
+{
+public:
+
+	explicit message_fifo	( const char* name_,						///< channel name
+							  unsigned int size_ = message_fifo_size	///< capacity (bytes)
+							);
+
+// message_fifo_in_if ==========================================================
+	unsigned int read_msg		( sc_dt::uchar* data, unsigned int max_length );
+
+	bool nb_read_msg			( sc_dt::uchar* data, unsigned int max_length, unsigned int& length );
+
+	unsigned int nb_read_msgs	( sc_dt::uchar* data, unsigned int max_count, unsigned int stride );
+
+	unsigned int num_messages	( void ) const;
+
+	const sc_core::sc_event& message_written_event	( void ) const;
+
+// message_fifo_out_if =========================================================
+	void write_msg				( const sc_dt::uchar* data, unsigned int length );
+
+	virtual bool nb_write_msg	( const sc_dt::uchar* data, unsigned int length );
+
+	unsigned int num_free_bytes	( void ) const;
+
+	const sc_core::sc_event& message_read_event		( void ) const;
+
+	virtual const char* kind	( void ) const;
+
+protected:
+
+	void update					( void );
+
+private:
+
+	void copy_in				( const sc_dt::uchar* src, unsigned int count );
+
+	void copy_out				( sc_dt::uchar* dst, unsigned int count );
+
+	void request_update_once	( void );
+
+	std::vector<sc_dt::uchar>	mf_buf;									///< ring buffer
+	unsigned int				mf_size;								///< capacity of the ring buffer
+	unsigned int				mf_ri;									///< read position
+	unsigned int				mf_wi;									///< write position
+	unsigned int				mf_bytes_readable, mf_msgs_readable;	///< bytes and messages readable in this delta cycle
+	unsigned int				mf_bytes_read, mf_msgs_read;			///< bytes and messages read in this delta cycle
+	unsigned int				mf_bytes_written, mf_msgs_written;		///< bytes and messages written in this delta cycle
+	bool						mf_update_pending;						///< update already requested for this delta cycle
+	sc_core::sc_event			mf_read_event;
+	sc_core::sc_event			mf_written_event;
+};
+
+#endif /*__MESSAGE_FIFO_H__*/
@@ -0,0 +1,96 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "multicast_extension.h"
+
+
+//======================================================================
+/// @fn multicast_extension
+//
+/// @brief constructor. No target is set.
+//
+//======================================================================
+multicast_extension::multicast_extension ( void )
+	: mc_slice ( 0 )
+{
+}
+
+
+//======================================================================
+/// @fn clone
+//
+/// @brief returns a copy of the extension
+//
+//======================================================================
+tlm::tlm_extension_base* multicast_extension::clone ( void ) const
+{
+	multicast_extension		*ext = new multicast_extension;
+
+	ext->copy_from( *this );
+	return ext;
+}
+
+
+//======================================================================
+/// @fn copy_from
+//
+/// @brief copies the targets and the results of another multicast extension
+//
+//======================================================================
+void multicast_extension::copy_from ( const tlm::tlm_extension_base& ext )
+{
+	const multicast_extension	&mc = static_cast<const multicast_extension&>(ext);
+
+	mc_targets	= mc.mc_targets;
+	mc_slice	= mc.mc_slice;
+	mc_delays	= mc.mc_delays;
+	mc_status	= mc.mc_status;
+}
+
+
+//======================================================================
+/// @fn set_targets
+//
+/// @brief addresses all targets of the router in the order of their sockets
+//
+/// @details The results are sized for them, so that the router doesn't
+///		allocate during the simulation.
+//
+//======================================================================
+void multicast_extension::set_targets ( unsigned int target_number, unsigned int slice )
+{
+	mc_targets.resize( target_number );
+	for (unsigned int i = 0; i < target_number; i++)
+	{
+		mc_targets[i] = i;
+	}
+	mc_slice = slice;
+	mc_delays.assign( target_number, sc_core::SC_ZERO_TIME );
+	mc_status.assign( target_number, tlm::TLM_INCOMPLETE_RESPONSE );
+}
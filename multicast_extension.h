@@ -0,0 +1,73 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file multicast_extension.h
+//
+///  @brief This is the extension of a write transaction which delivers its
+///		data to several targets of a router in one call
+///
+///  @details
+///		A router supporting it ( interconnect4::b_transport() ) forwards the 
+///		transaction to each target of #mc_targets, either with the whole data 
+///		(broadcast) or with the slice of #mc_slice bytes at the position of the
+///		target in the list (scatter). It fills the delay annotated and the 
+///		response returned by each target.
+//		
+//==============================================================================
+
+#ifndef __MULTICAST_EXTENSION_H__
+#define __MULTICAST_EXTENSION_H__
+
+#include <systemc.h>
+#include <tlm.h>
+#include <vector>
+
+class multicast_extension : public tlm::tlm_extension<multicast_extension>
+{
+public:
+
+	multicast_extension					( void );
+
+	virtual tlm::tlm_extension_base* clone	( void ) const;
+
+	virtual void copy_from				( const tlm::tlm_extension_base& ext		///< extension to be copied
+										);
+
+	void set_targets					( unsigned int target_number,				///< number of targets of the router, all of them are addressed
+										  unsigned int slice						///< bytes per target, 0 to send the whole data to each target
+										);
+
+	std::vector<unsigned int>				mc_targets;								///< socket indexes of the targets
+	unsigned int							mc_slice;								///< bytes per target, 0 for a broadcast
+	std::vector<sc_core::sc_time>			mc_delays;								///< delay annotated by each target, filled by the router
+	std::vector<tlm::tlm_response_status>	mc_status;								///< response of each target, filled by the router
+};
+
+#endif /*__MULTICAST_EXTENSION_H__*/
@@ -0,0 +1,170 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "payload_pool.h"
+#include "reporting.h"
+
+static const char *filename = "payload_pool.cpp";
+
+
+//======================================================================
+/// @fn payload_pool
+//
+/// @brief constructor
+//
+//======================================================================
+payload_pool::payload_pool ( void )
+{
+}
+
+
+//======================================================================
+/// @fn ~payload_pool
+//
+/// @brief destructor
+//
+/// @details It deletes all the transaction objects created by the pool,
+///		including the ones which weren't returned.
+//
+//======================================================================
+payload_pool::~payload_pool ( void )
+{
+	for ( unsigned int i = 0; i < pp_all.size(); i++ )
+	{
+		delete pp_all[i];
+	}
+}
+
+
+//======================================================================
+/// @fn add_template
+//
+/// @brief registers a new template for the transaction objects of an initiator
+//
+/// @retval index of the template to be passed to allocate()
+//
+//======================================================================
+unsigned int payload_pool::add_template (	tlm::tlm_command cmd,
+											unsigned int data_length	)
+{
+	payload_template	tmpl;
+
+	tmpl.t_cmd			= cmd;
+	tmpl.t_data_length	= data_length;
+
+	pp_templates.push_back	( tmpl );
+	pp_free_lists.push_back	( std::vector< pooled_payload* >() );
+
+	return (unsigned int)(pp_templates.size() - 1);
+}
+
+
+//======================================================================
+/// @fn allocate
+//
+/// @brief takes a transaction object of the given template from the pool
+//
+/// @details
+///		A new transaction object is only created if the free list of the 
+///		template is empty. The returned object is already acquired once, 
+///		the caller gives it back by calling release() on it.
+//
+/// @retval pointer to the transaction object
+//
+//======================================================================
+tlm::tlm_generic_payload* payload_pool::allocate ( unsigned int tmpl_id )
+{
+	std::ostringstream	msg;
+	pooled_payload		*tObj;
+
+	if ( tmpl_id >= pp_templates.size() )
+	{
+		msg << "\t Invalid template index: " << tmpl_id;
+		ERROR_LOG(filename, __FUNCTION__ , msg.str());
+		return 0;
+	}
+
+	if ( pp_free_lists[tmpl_id].empty() )
+	{
+		tObj = new pooled_payload( this, tmpl_id, pp_templates[tmpl_id].t_data_length );
+		pp_all.push_back( tObj );
+		restore( tObj );
+	}
+	else
+	{
+		tObj = pp_free_lists[tmpl_id].back();
+		pp_free_lists[tmpl_id].pop_back();
+	}
+	tObj->acquire();
+
+	return tObj;
+}
+
+
+//======================================================================
+/// @fn free
+//
+/// @brief returns a transaction object to the free list of its template
+//
+/// @details
+///		It is called by release() when the reference count of the object 
+///		drops to zero. The object is restored before it is stored again.
+//
+//======================================================================
+void payload_pool::free ( tlm::tlm_generic_payload* tObj )
+{
+	pooled_payload		*pObj = static_cast<pooled_payload*>(tObj);
+
+	pObj->reset();
+	restore( pObj );
+	pp_free_lists[pObj->p_tmpl_id].push_back( pObj );
+}
+
+
+//======================================================================
+/// @fn restore
+//
+/// @brief sets all attributes of the transaction object from its template
+//
+//======================================================================
+void payload_pool::restore ( pooled_payload* tObj )
+{
+	payload_template	&tmpl = pp_templates[tObj->p_tmpl_id];
+
+	tObj->set_command			( tmpl.t_cmd					);
+	tObj->set_address			( 0								);
+	tObj->set_data_ptr			( tObj->p_buffer				);
+	tObj->set_data_length		( tmpl.t_data_length			);
+	tObj->set_streaming_width	( tmpl.t_data_length			);
+	tObj->set_response_status	( tlm::TLM_INCOMPLETE_RESPONSE	);
+	tObj->set_gp_option			( tlm::TLM_MIN_PAYLOAD			);
+	tObj->set_dmi_allowed		( false							);
+	tObj->set_byte_enable_ptr	( 0								);
+	tObj->set_byte_enable_length( 0								);
+}
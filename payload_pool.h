@@ -0,0 +1,105 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file payload_pool.h
+//
+///  @brief This is the memory manager for the transaction objects of a node
+//
+///  @details
+///		The pool hands out reference counted transaction objects ( tlm_mm_interface ).
+///		Each initiator registers a template for each kind of transaction it performs.
+///		A transaction object allocated with a template comes with a pooled data buffer
+///		and with the attributes of the template already set. When its reference count
+///		drops to zero, it returns to the free list of its template and is restored,
+///		so that the initiators only have to set the address before each call. <br>
+///		As the transaction objects aren't shared anymore, an initiator can have more
+///		than one transaction in flight.
+//		
+//==============================================================================
+
+#ifndef __PAYLOAD_POOL_H__
+#define __PAYLOAD_POOL_H__
+
+#include <systemc.h>
+#include <tlm.h>
+#include <vector>
+
+class payload_pool : public tlm::tlm_mm_interface
+{
+
+// Member Methods  ====================================================
+public:
+
+	payload_pool	( void );
+
+	~payload_pool	( void );
+
+	unsigned int add_template			(	tlm::tlm_command cmd,							///< command of the transactions
+											unsigned int data_length						///< data length of the transactions (bytes)
+										);
+
+	tlm::tlm_generic_payload* allocate	(	unsigned int tmpl_id							///< index of the template returned by add_template()
+										);
+
+	void free							(	tlm::tlm_generic_payload* tObj					///< pointer to the transaction object to be returned
+										);
+
+// Member Variables/Objects  ===================================================
+private:
+
+	/// transaction object of the pool with its data buffer and its template
+	struct pooled_payload : public tlm::tlm_generic_payload
+	{
+		pooled_payload	( tlm::tlm_mm_interface* mm, unsigned int tmpl_id, unsigned int data_length )
+			: tlm::tlm_generic_payload(mm), p_tmpl_id(tmpl_id), p_buffer(new unsigned char[size_t(data_length)])
+		{
+			memset(p_buffer, 0, size_t(data_length));
+		}
+		~pooled_payload	( void )	{ delete [] p_buffer; }
+
+		unsigned int				p_tmpl_id;											///< index of the template
+		unsigned char				*p_buffer;											///< pooled data buffer
+	};
+
+	/// attributes set on every transaction object of a template
+	struct payload_template
+	{
+		tlm::tlm_command			t_cmd;												///< command
+		unsigned int				t_data_length;										///< data length and streaming width (bytes)
+	};
+
+	void restore						(	pooled_payload* tObj							///< pointer to the transaction object to be restored
+										);
+
+	std::vector< payload_template >					pp_templates;						///< registered templates
+	std::vector< std::vector< pooled_payload* > >	pp_free_lists;						///< free transaction objects of each template
+	std::vector< pooled_payload* >					pp_all;								///< all transaction objects created by the pool
+};
+#endif /*__PAYLOAD_POOL_H__*/
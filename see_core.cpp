@@ -29,16 +29,79 @@
 
 #include "see_core.h"
 
+static const char *filename = "see_core.cpp";
+
 //==============================================================================
 ///  @fn see_core::see_core
 //  
 ///  @brief Constructor.
 //
+///  @details It precompiles the rules of the decision table if a rule file is given.
+///		A rejected rule file leaves the table empty, so that every decision is
+///		computed by eval_and_decide().
 //==============================================================================
 see_core::see_core	(	std::string node_name_
+					,	unsigned int lm_length_						///< length of the LM result data
+					,	unsigned int gvoc_length_					///< length of the gvoc data
+					,	unsigned int decision_length_				///< length of the decision data
+					,	const char* rule_file_						///< rule file of the decision table, 0 without decision table
 					):
 					see_parent_name (node_name_)
+					, seecore_decisions (lm_length_, gvoc_length_, decision_length_, see_decision_cache_size)
+{
+	if ( rule_file_ )
+	{
+		if ( !seecore_decisions.load( rule_file_ ) )
+		{
+			std::ostringstream	msg;
+			msg << "\t" << see_parent_name << ": rule file " << rule_file_ << " rejected, SEE runs without decision table!";
+			WARNING_LOG(filename, __FUNCTION__, msg.str());
+		}
+	}
+}
+
+//==============================================================================
+///  @fn see_core::decide
+//  
+///  @brief decides which actions should be taken for the result data of LModel
+///		and the gvoc data
+//
+///	 @details 
+///		With a decision table, the decision is looked up in the table and only
+///		computed by eval_and_decide() if it is unknown. The computed decision is 
+///		then cached as depending on the gvoc data. Without decision table, each
+///		decision is computed by eval_and_decide().
+//
+///	 @see see_decisions::lookup()
+//==============================================================================
+void see_core::decide(memory &lm_mem, memory &gvoc_mem, unsigned char* see_dec_data)
+{
+	if ( seecore_decisions.rules() == 0 )
+	{
+		eval_and_decide(lm_mem, gvoc_mem, see_dec_data);
+		return;
+	}
+	if ( !seecore_decisions.lookup(lm_mem.get_mem_ptr(), see_dec_data) )
+	{
+		eval_and_decide(lm_mem, gvoc_mem, see_dec_data);
+		seecore_decisions.insert(see_dec_data, true);
+	}
+}
+
+//==============================================================================
+///  @fn see_core::gvoc_changed
+//  
+///  @brief updates the gvoc state of the decision table after a write on the
+///		gvoc memory
+//
+///	 @see see_decisions::set_gvoc()
+//==============================================================================
+void see_core::gvoc_changed(memory &gvoc_mem)
 {
+	if ( seecore_decisions.rules() > 0 )
+	{
+		seecore_decisions.set_gvoc(gvoc_mem.get_mem_ptr());
+	}
 }
 
 //==============================================================================
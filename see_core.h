@@ -45,14 +45,22 @@
 #include "key_functions.h"
 #include "constants.h"
 #include "memory.h"
+#include "see_decisions.h"
 
 class see_core {
 public:
 	see_core(	std::string node_name_
+			,	unsigned int lm_length_						///< length of the LM result data
+			,	unsigned int gvoc_length_					///< length of the gvoc data
+			,	unsigned int decision_length_				///< length of the decision data
+			,	const char* rule_file_						///< rule file of the decision table, 0 without decision table
 			);
+	void decide(memory &lm_mem, memory &gvoc_mem, unsigned char* see_dec_data);
 	void eval_and_decide(memory &lm_mem, memory &gvoc_mem, unsigned char* see_dec_data);
+	void gvoc_changed(memory &gvoc_mem);
 
 private:
 	std::string			seecore_output_filename, see_parent_name;
+	see_decisions		seecore_decisions;			///< decision table
 }; 
 #endif
\ No newline at end of file
@@ -0,0 +1,334 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "see_decisions.h"
+#include "reporting.h"
+
+static const char *filename = "see_decisions.cpp";
+
+
+//======================================================================
+/// @fn see_decisions
+//
+/// @brief constructor. The table has no rule and the g.v.o.c. data is zero.
+//
+//======================================================================
+see_decisions::see_decisions ( unsigned int lm_length, unsigned int gvoc_length, unsigned int decision_length, unsigned int capacity )
+	: sd_lm_length			( lm_length			)
+	, sd_gvoc_length		( gvoc_length		)
+	, sd_decision_length	( decision_length	)
+	, sd_capacity			( capacity			)
+	, sd_lm_hash			( 0					)
+{
+	sd_gvoc_hash = padded_hash( std::vector<datyp>(), sd_gvoc_length );
+}
+
+
+//======================================================================
+/// @fn load
+//
+/// @brief precompiles the rules of a rule file
+//
+/// @details A later rule for the same data replaces an earlier one.
+///		A malformed rule is reported with its line number and clears the
+///		whole table, so that no table is half loaded.
+//
+/// @retval false if the file couldn't be opened or is malformed
+//
+//======================================================================
+bool see_decisions::load ( const char* file_name )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(INPUTDIR) + std::string(file_name);
+	std::ifstream		infile( strfname.c_str() );
+	std::string			line;
+	unsigned int		line_nr = 0;
+
+	if ( !infile.is_open() )
+	{
+		msg << "i couldn't open file " << strfname << "!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		return false;
+	}
+
+	while ( std::getline(infile, line) )
+	{
+		std::istringstream	fields( line );
+		std::string			part[3];
+		std::string			rest;
+		std::vector<datyp>	data[3];
+		bool				any_gvoc;
+		sc_dt::uint64		lm_hash;
+		unsigned int		value;
+
+		line_nr++;
+		if ( line.empty() || line[0] == '#' )
+		{
+			continue;
+		}
+		if ( !std::getline(fields, part[0], ';') || !std::getline(fields, part[1], ';') || !std::getline(fields, part[2]) )
+		{
+			msg << strfname << ":" << line_nr << ": a rule needs lm bytes ; gvoc bytes or * ; decision bytes, not \"" << line << "\"!";
+			ERROR_LOG(filename, __FUNCTION__, msg.str());
+			clear();
+			return false;
+		}
+		any_gvoc = ( part[1].find('*') != std::string::npos );
+		for (int i = 0; i < 3; i++)
+		{
+			std::istringstream	bytes( part[i] );
+
+			while ( bytes >> value )
+			{
+				data[i].push_back( datyp(value) );
+			}
+			bytes.clear();
+			if ( (bytes >> rest) && !( i == 1 && any_gvoc && rest == "*" ) )
+			{
+				msg << strfname << ":" << line_nr << ": \"" << rest << "\" isn't a byte value in \"" << line << "\"!";
+				ERROR_LOG(filename, __FUNCTION__, msg.str());
+				clear();
+				return false;
+			}
+		}
+
+		data[2].resize( sd_decision_length, 0 );
+		sd_decisions.push_back( data[2] );
+		lm_hash = padded_hash( data[0], sd_lm_length );
+		if ( any_gvoc )
+		{
+			sd_any_rules[lm_hash] = (unsigned int)sd_decisions.size() - 1;
+		}
+		else
+		{
+			sd_gvoc_rules[ combine(lm_hash, padded_hash(data[1], sd_gvoc_length)) ] = (unsigned int)sd_decisions.size() - 1;
+		}
+	}
+	return true;
+}
+
+
+//======================================================================
+/// @fn lookup
+//
+/// @brief looks up the decision for the LM result data and the current
+///		g.v.o.c. data
+//
+/// @details The cache is looked up first, then the rules for the current
+///		g.v.o.c. state and then the rules for any g.v.o.c. state. The decision
+///		of a matching rule is cached.
+//
+/// @retval false if no decision is known; the decision computed by the 
+///		caller can then be cached with insert()
+//
+//======================================================================
+bool see_decisions::lookup ( const unsigned char* lm_data, unsigned char* decision )
+{
+	std::map<sc_dt::uint64, decision_list::iterator>::iterator	hit;
+	std::map<sc_dt::uint64, unsigned int>::const_iterator		rule;
+	sc_dt::uint64												key;
+
+	sd_lm_hash	= hash( lm_data, sd_lm_length );
+	key			= combine( sd_lm_hash, sd_gvoc_hash );
+
+	hit = sd_cache.find( key );
+	if ( hit != sd_cache.end() )
+	{
+		sd_lru.splice( sd_lru.begin(), sd_lru, hit->second );
+		memcpy( decision, &sd_lru.front().c_decision[0], sd_decision_length );
+		return true;
+	}
+
+	rule = sd_gvoc_rules.find( key );
+	if ( rule != sd_gvoc_rules.end() )
+	{
+		memcpy( decision, &sd_decisions[rule->second][0], sd_decision_length );
+		insert( decision, true );
+		return true;
+	}
+
+	rule = sd_any_rules.find( sd_lm_hash );
+	if ( rule != sd_any_rules.end() )
+	{
+		memcpy( decision, &sd_decisions[rule->second][0], sd_decision_length );
+		insert( decision, false );
+		return true;
+	}
+	return false;
+}
+
+
+//======================================================================
+/// @fn insert
+//
+/// @brief caches a decision for the LM result data of the last lookup and
+///		the current g.v.o.c. data, dropping the least recently used one if 
+///		the cache is full
+//
+//======================================================================
+void see_decisions::insert ( const unsigned char* decision, bool gvoc_dependent )
+{
+	cached_decision		entry;
+
+	if ( sd_capacity == 0 || sd_decision_length == 0 )
+	{
+		return;
+	}
+	if ( sd_cache.size() >= sd_capacity )
+	{
+		sd_cache.erase( sd_lru.back().c_key );
+		sd_lru.pop_back();
+	}
+
+	entry.c_key				= combine( sd_lm_hash, sd_gvoc_hash );
+	entry.c_lm_hash			= sd_lm_hash;
+	entry.c_gvoc_dependent	= gvoc_dependent;
+	entry.c_decision.assign( decision, decision + sd_decision_length );
+
+	sd_lru.push_front( entry );
+	sd_cache[entry.c_key] = sd_lru.begin();
+}
+
+
+//======================================================================
+/// @fn set_gvoc
+//
+/// @brief updates the g.v.o.c. state after a write on the g.v.o.c. data
+//
+/// @details The cached decisions depending on the g.v.o.c. data are 
+///		dropped. The others are rekeyed to the new state, unless a rule for 
+///		the new state overrides them.
+//
+//======================================================================
+void see_decisions::set_gvoc ( const unsigned char* gvoc_data )
+{
+	sc_dt::uint64				gvoc_hash	= hash( gvoc_data, sd_gvoc_length );
+	decision_list::iterator		entry		= sd_lru.begin();
+
+	if ( gvoc_hash == sd_gvoc_hash )
+	{
+		return;
+	}
+	sd_gvoc_hash = gvoc_hash;
+
+	sd_cache.clear();
+	while ( entry != sd_lru.end() )
+	{
+		entry->c_key = combine( entry->c_lm_hash, sd_gvoc_hash );
+		if ( entry->c_gvoc_dependent || sd_gvoc_rules.count(entry->c_key) > 0 )
+		{
+			entry = sd_lru.erase( entry );
+		}
+		else
+		{
+			sd_cache[entry->c_key] = entry;
+			++entry;
+		}
+	}
+}
+
+
+//======================================================================
+/// @fn rules
+//
+/// @brief returns the number of precompiled rules
+//
+//======================================================================
+unsigned int see_decisions::rules ( void ) const
+{
+	return (unsigned int)sd_decisions.size();
+}
+
+
+//======================================================================
+/// @fn clear
+//
+/// @brief removes all rules and cached decisions
+//
+//======================================================================
+void see_decisions::clear ( void )
+{
+	sd_decisions.clear();
+	sd_gvoc_rules.clear();
+	sd_any_rules.clear();
+	sd_lru.clear();
+	sd_cache.clear();
+}
+
+
+//======================================================================
+/// @fn hash
+//
+/// @brief 64 bit FNV-1a hash of a byte array
+//
+//======================================================================
+sc_dt::uint64 see_decisions::hash ( const unsigned char* data, unsigned int length )
+{
+	sc_dt::uint64	h	= 14695981039346656037ULL;
+
+	for (unsigned int i = 0; i < length; i++)
+	{
+		h ^= data[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+
+//======================================================================
+/// @fn combine
+//
+/// @brief combines the hashes of the LM result data and of the g.v.o.c.
+///		data into the key of a decision
+//
+//======================================================================
+sc_dt::uint64 see_decisions::combine ( sc_dt::uint64 lm_hash, sc_dt::uint64 gvoc_hash )
+{
+	return lm_hash ^ ( gvoc_hash + 0x9e3779b97f4a7c15ULL + (lm_hash << 6) + (lm_hash >> 2) );
+}
+
+
+//======================================================================
+/// @fn padded_hash
+//
+/// @brief hash of the bytes of a rule, zero padded or truncated to the 
+///		length of the data they are compared with
+//
+//======================================================================
+sc_dt::uint64 see_decisions::padded_hash ( const std::vector<datyp>& data, unsigned int length ) const
+{
+	std::vector<datyp>	padded( data );
+
+	padded.resize( length, 0 );
+	return hash( padded.empty() ? 0 : &padded[0], length );
+}
@@ -0,0 +1,119 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file see_decisions.h
+//
+///  @brief This is the decision table of the see component
+///
+///  @details
+///		The decisions are keyed by a 64 bit FNV-1a hash of the LM result data
+///		combined with the hash of the g.v.o.c. data. The rules of a rule file 
+///		are precompiled into two tables at startup: rules for a given g.v.o.c.
+///		state and rules valid for any g.v.o.c. state. <br>
+///		The decisions in use are held in a LRU cache, so that SEE needs one
+///		lookup per process cycle in the common case. When the g.v.o.c. data
+///		changes, only the cached decisions depending on it are dropped; the 
+///		others are rekeyed to the new g.v.o.c. state. <br>
+///		A rule file has one rule per line: the LM result bytes, ';', the 
+///		g.v.o.c. bytes or '*' for any g.v.o.c. state, ';' and the decision 
+///		bytes, all as decimal values. Missing bytes are zero. Lines starting 
+///		with '#' are ignored.
+//		
+//==============================================================================
+
+#ifndef __SEE_DECISIONS_H__
+#define __SEE_DECISIONS_H__
+
+#include <systemc.h>
+#include <list>
+#include <map>
+#include <vector>
+
+#include "constants.h"
+
+class see_decisions
+{
+public:
+
+	see_decisions		( unsigned int lm_length,									///< length of the LM result data
+						  unsigned int gvoc_length,									///< length of the g.v.o.c. data
+						  unsigned int decision_length,								///< length of the decision data
+						  unsigned int capacity										///< number of cached decisions
+						);
+
+	bool load			( const char* file_name										///< rule file name, relative to INPUTDIR
+						);
+
+	bool lookup			( const unsigned char* lm_data,								///< LM result data
+						  unsigned char* decision									///< buffer for the decision
+						);
+
+	void insert			( const unsigned char* decision,							///< decision computed for the data of the last lookup
+						  bool gvoc_dependent										///< the decision depends on the g.v.o.c. data
+						);
+
+	void set_gvoc		( const unsigned char* gvoc_data							///< new g.v.o.c. data
+						);
+
+	unsigned int rules	( void ) const;
+
+	void clear			( void );
+
+	static sc_dt::uint64 hash	( const unsigned char* data, unsigned int length );
+
+private:
+
+	/// decision in the cache
+	struct cached_decision
+	{
+		sc_dt::uint64			c_key;										///< combined key
+		sc_dt::uint64			c_lm_hash;									///< hash of the LM result data
+		bool					c_gvoc_dependent;							///< depends on the g.v.o.c. data
+		std::vector<datyp>		c_decision;									///< decision data
+	};
+
+	typedef std::list<cached_decision>	decision_list;
+
+	static sc_dt::uint64 combine	( sc_dt::uint64 lm_hash, sc_dt::uint64 gvoc_hash );
+
+	sc_dt::uint64 padded_hash		( const std::vector<datyp>& data, unsigned int length ) const;
+
+	unsigned int					sd_lm_length, sd_gvoc_length, sd_decision_length;	///< data lengths
+	unsigned int					sd_capacity;								///< number of cached decisions
+	sc_dt::uint64					sd_gvoc_hash;								///< hash of the current g.v.o.c. data
+	sc_dt::uint64					sd_lm_hash;									///< hash of the LM result data of the last lookup
+	std::vector< std::vector<datyp> >			sd_decisions;					///< decisions of the rules
+	std::map<sc_dt::uint64, unsigned int>		sd_gvoc_rules;					///< rules for a g.v.o.c. state, by combined key
+	std::map<sc_dt::uint64, unsigned int>		sd_any_rules;					///< rules for any g.v.o.c. state, by LM hash
+	decision_list								sd_lru;							///< cached decisions, most recently used first
+	std::map<sc_dt::uint64, decision_list::iterator>	sd_cache;				///< cached decisions by combined key
+};
+
+#endif /*__SEE_DECISIONS_H__*/
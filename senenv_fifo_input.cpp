@@ -27,6 +27,8 @@
 *    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+
 #include "senenv_fifo_input.h"
 #include "reporting.h"
 
@@ -40,23 +42,91 @@ static const char *filename = "stimulus.cpp";				///< filename for reporting
 ///	@details It registers the method process of the module to the kernel.
 ////	<br> It initializes the vector of output ports with the number of fifo channels  
 ///		to which they ports should later be bounded to and specified during instantiation.
-///		<br> It finally reads out the input file for sensor data.
+///		<br> It finally opens the input file for sensor data as the source of the first 
+///		port, or as the trace feeding all ports. The other sources are set with set_source().
 //
 //========================================================================================
 senenv_fifo_input::senenv_fifo_input	( sc_module_name	module_name				///< sc module name
 					, unsigned int		out_port_nr									///< number of output ports
 					, sc_core::sc_time	glob_quantum_								///< time value for the global quantum
 					, char*				filename_									///< input file name
+					, sc_core::sc_time	start_time_									///< simulated time of the trace at which the run starts
+					, unsigned int		dataset_length_								///< length of a dataset (bytes)
+					, unsigned int		nr_dataset_cycle_							///< number of datasets per port and process cycle
+					, input_end_mode	end_mode_									///< behaviour at the end of the input
 					): 
 					   s_out_port_nr(out_port_nr)
 					,  out_ports("Stimulus_nr")
 					,  glob_quantum(glob_quantum_)
 					,  s_counter ( 0 )
 					,  inputfile( filename_)
+					,  s_dataset_length ( dataset_length_ )
+					,  s_nr_dataset_cycle ( nr_dataset_cycle_ )
+					,  s_end_mode ( end_mode_ )
+					,  s_sources ( out_port_nr, (stimulus_source*)0 )
+					,  s_last ( out_port_nr, std::vector<datyp>(dataset_length_) )
+					,  s_data ( size_t(dataset_length_) * nr_dataset_cycle_ )
+					,  s_trace_mode ( false )
+					,  s_start_time ( start_time_ )
+					,  s_trace_base ( sc_core::SC_ZERO_TIME )
+					,  s_block_valid ( false )
 {
 	SC_METHOD(senenv_fifo_input_thread);
 	out_ports.init(s_out_port_nr);
-	read_data(inputfile);
+	if (inputfile)
+	{
+		read_data(inputfile);
+	}
+}
+
+
+//========================================================================================
+///  @fn ~senenv_fifo_input
+//
+///  @brief destructor. It deletes the stimulus sources.
+//
+//========================================================================================
+senenv_fifo_input::~senenv_fifo_input(void)
+{
+	for (unsigned int i = 0; i < s_sources.size(); i++)
+	{
+		delete s_sources[i];
+	}
+}
+
+
+//========================================================================================
+///  @fn set_source
+//
+///  @brief sets the stimulus source of an output port. The module takes its ownership.
+//
+//========================================================================================
+void senenv_fifo_input::set_source(unsigned int port, stimulus_source* source)
+{
+	delete s_sources.at(port);
+	s_sources[port] = source;
+}
+
+
+//========================================================================================
+///  @fn set_generators
+//
+///  @brief sets a synthetic generator as the source of every output port.
+//
+///	 @details The generator of port i is seeded with the seed of the configuration plus i,
+///		so that the sensors get different but reproducible noise.
+//
+/// @see generator_source
+//========================================================================================
+void senenv_fifo_input::set_generators(const generator_config& config)
+{
+	generator_config	port_config	= config;
+
+	for (unsigned int i = 0; i < s_sources.size(); i++)
+	{
+		port_config.seed = config.seed + i;
+		set_source(i, new generator_source(port_config));
+	}
 }
 
 
@@ -64,49 +134,236 @@ senenv_fifo_input::senenv_fifo_input	( sc_module_name	module_name				///< sc mod
 ///  @fn stimulus_thread
 //
 ///  @brief method process. It is triggered after every quantum time and writes the sensor 
-///		data into the fifo channel(s) before the transactions start. 
+///		data of one process cycle into the fifo channel of each port with a source before 
+///		the transactions start. 
 //
 ///	 @details Before every write operation, it makes sure that there is unoccupied slots in 
-///		the fifo available.<br>
+///		the fifo available. The simulation is stopped when a source has no more data in 
+///		the INPUT_STOP mode.<br>
+///		In the trace mode, the blocks of the trace are written instead at the time given 
+///		by their timestamp.<br>
 ///		This can be modified to better suit the user needs
+//
+/// @see fill_port
+/// @see write_trace_block
 //========================================================================================
 void senenv_fifo_input::senenv_fifo_input_thread(void)
 {
-	std::ostringstream msg;
-	msg.str("");
-	msg<< "\t FIFO NR: " << s_out_port_nr;
+	if (s_trace_mode)
+	{
+		write_trace_block();
+		return;
+	}
+
+	std::ostringstream	msg;
+	bool				available	= true;
 
-	if (out_ports.at(0)->num_free() > 0)
+	for (unsigned int i = 0; i < s_sources.size(); i++)
 	{
-		if(s_counter < data_vector.size())
-		{
-			out_ports[0] -> write(data_vector.at(s_counter));
-		}
-		else
+		if (s_sources[i])
 		{
-			msg<< " NO DATA AVAILABLE!" << s_counter;
-			sc_core::sc_stop();
+			available = fill_port(i) && available;
 		}
 	}
-	else
+	s_counter++;
+
+	if (!available)
 	{
-		msg<< "NO FREE SLOTS IN THE FIFO CHANNEL!";
-		ERROR_LOG( filename, __FUNCTION__, msg.str() );
+		msg<< "\t FIFO NR: " << s_out_port_nr << " NO DATA AVAILABLE!" << s_counter;
+		INFO_LOG( filename, __FUNCTION__, msg.str() );
+		sc_core::sc_stop();
+		return;
 	}
 	
 	sc_core::next_trigger(glob_quantum);
 }
 
 
+//========================================================================================
+///  @fn fill_port
+//
+///  @brief It writes the datasets of a process cycle from the source of a port into its 
+///		fifo channel with one bulk write.
+//
+///	 @details When the source runs out of data, it is rewound in the INPUT_LOOP mode and 
+///		its last dataset is repeated in the INPUT_HOLD mode. In the INPUT_STOP mode, the 
+///		complete datasets left are written.
+//
+///	 @retval false if the source couldn't deliver all the datasets
+//========================================================================================
+bool senenv_fifo_input::fill_port(unsigned int port)
+{
+	std::ostringstream	msg;
+	size_t				need	= s_data.size();
+	size_t				got;
+
+	if (need == 0)
+	{
+		return true;
+	}
+	if (out_ports[port]->num_free() < int(need))
+	{
+		msg<< "\t FIFO NR: " << port << " NO FREE SLOTS IN THE FIFO CHANNEL!";
+		ERROR_LOG( filename, __FUNCTION__, msg.str() );
+		return true;
+	}
+
+	got = s_sources[port]->read(&s_data[0], need);
+	if (got < need)
+	{
+		switch (s_end_mode)
+		{
+		case INPUT_LOOP:
+			while (got < need && s_sources[port]->rewind())
+			{
+				size_t n = s_sources[port]->read(&s_data[got], need - got);
+				if (n == 0)
+				{
+					break;
+				}
+				got += n;
+			}
+			break;
+		case INPUT_HOLD:
+			got -= got % s_dataset_length;
+			if (got >= s_dataset_length)
+			{
+				std::copy(s_data.begin() + (got - s_dataset_length), s_data.begin() + got, s_last[port].begin());
+			}
+			for (; got < need; got += s_dataset_length)
+			{
+				std::copy(s_last[port].begin(), s_last[port].end(), s_data.begin() + got);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	got -= got % s_dataset_length;										// complete datasets only
+	if (got > 0)
+	{
+		std::copy(s_data.begin() + (got - s_dataset_length), s_data.begin() + got, s_last[port].begin());
+		out_ports[port]->nb_write_n(&s_data[0], int(got));
+	}
+	return got == need;
+}
+
+
 //========================================================================================
 ///  @fn read_data
 //
-///  @brief It readouts the input file and stores the data in a vector.
+///  @brief It opens the input file for the streaming reader.
+//
+///	 @details The file is not loaded in memory: it is read in chunks by the
+///		prefetch thread of the reader while the data is written into the fifo.
+///		<br> If the file is a trace file, the reader is positioned on the block
+///		of the start time with the index of the trace and the first block is read.
 //
-///	 @details to be implemented according to the needs
+/// @see stream_reader
+/// @see trace_reader
 //
 //========================================================================================
-void senenv_fifo_input::read_data(char* filename)
+void senenv_fifo_input::read_data(char* file_name)
 {
-	file_ops::read_out_file(&data_vector , filename);
+	std::ostringstream msg;
+
+	if (!trace_reader::is_trace(file_name))
+	{
+		if (s_out_port_nr > 0)
+		{
+			set_source(0, new file_source(file_name));
+		}
+		return;
+	}
+
+	s_trace_mode = true;
+	if (!s_trace.open(file_name))
+	{
+		return;
+	}
+
+	const trace_header& hdr = s_trace.header();
+	if (hdr.channel_count < unsigned(s_out_port_nr))
+	{
+		msg << "\t the trace has " << hdr.channel_count << " channels for " << s_out_port_nr << " ports!";
+		WARNING_LOG( filename, __FUNCTION__, msg.str() );
+	}
+	s_block.resize(size_t(hdr.channel_count) * hdr.dataset_length);
+	s_block_valid = !s_block.empty() && s_trace.seek(s_start_time) && s_trace.next_block(s_block_time, &s_block[0]);
+}
+
+
+//========================================================================================
+///  @fn write_trace_block
+//
+///  @brief It writes the dataset of each channel of the pending block into the fifo 
+///		channel of the corresponding port and reads the next block.
+//
+///	 @details The method process is then triggered again at the time of the next block,
+///		relative to the start time. At the end of the trace, it starts again from the start
+///		time in the INPUT_LOOP mode and the last block is repeated every quantum in the 
+///		INPUT_HOLD mode. A block which isn't due yet, e.g. the first block when its
+///		timestamp is after the start time, is only scheduled.
+//
+//========================================================================================
+void senenv_fifo_input::write_trace_block(void)
+{
+	std::ostringstream	msg;
+	unsigned int		length		= s_trace.header().dataset_length;
+	unsigned int		channels	= std::min(s_trace.header().channel_count, unsigned(s_out_port_nr));
+	sc_core::sc_time	due;
+
+	msg.str("");
+	msg<< "\t FIFO NR: " << s_out_port_nr;
+
+	if (!s_block_valid)
+	{
+		msg<< " NO DATA AVAILABLE!" << s_counter;
+		INFO_LOG( filename, __FUNCTION__, msg.str() );
+		sc_core::sc_stop();
+		return;
+	}
+
+	due = s_trace_base + (s_block_time > s_start_time ? s_block_time - s_start_time : sc_core::SC_ZERO_TIME);
+	if (due > sc_core::sc_time_stamp())
+	{
+		sc_core::next_trigger( due - sc_core::sc_time_stamp() );
+		return;
+	}
+
+	for (unsigned int i = 0; i < channels; i++)
+	{
+		if (out_ports[i]->num_free() >= int(length))
+		{
+			out_ports[i] -> nb_write_n(&s_block[i * length], int(length));
+		}
+		else
+		{
+			msg<< "NO FREE SLOTS IN THE FIFO CHANNEL " << i << "!";
+			ERROR_LOG( filename, __FUNCTION__, msg.str() );
+		}
+	}
+	s_counter++;
+
+	if (s_trace.next_block(s_block_time, &s_block[0]))
+	{
+		due = s_trace_base + (s_block_time > s_start_time ? s_block_time - s_start_time : sc_core::SC_ZERO_TIME);
+		sc_core::next_trigger( due > sc_core::sc_time_stamp() ? due - sc_core::sc_time_stamp() : sc_core::SC_ZERO_TIME );
+		return;
+	}
+
+	switch (s_end_mode)
+	{
+	case INPUT_LOOP:													// next pass one quantum later
+		s_trace_base	= sc_core::sc_time_stamp() + glob_quantum;
+		s_block_valid	= s_trace.seek(s_start_time) && s_trace.next_block(s_block_time, &s_block[0]);
+		break;
+	case INPUT_HOLD:													// the last block stays pending
+		break;
+	default:
+		s_block_valid	= false;
+		break;
+	}
+	sc_core::next_trigger(glob_quantum);
 }
\ No newline at end of file
@@ -34,7 +34,10 @@
 ///		channels of a node bounded to the input ports of the senenv components in each process
 ///		cycle before the transactions start.
 //
-///	@details To be implemented according to the needs
+///	@details In each activation, every output port with a stimulus source gets the 
+///		datasets of one process cycle. The end of the input of a source is handled 
+///		according to the #input_end_mode of the module. A trace file feeds all the 
+///		ports instead, one block at the time of its timestamp.
 //
 //========================================================================================
 
@@ -44,6 +47,11 @@
 #include <systemc.h>
 #include "constants.h"
 #include "key_functions.h"
+#include "stream_reader.h"
+#include "trace_file.h"
+#include "block_fifo.h"
+#include "stimulus_source.h"
+#include "generator_source.h"
 
 class senenv_fifo_input:public sc_module
 {
@@ -53,20 +61,45 @@ public:
 			, unsigned int		out_port_nr									///< number of output ports
 			, sc_core::sc_time	glob_quantum_								///< time value for the global quantum
 			, char*				filename_									///< input file name
+			, sc_core::sc_time	start_time_ = sc_core::SC_ZERO_TIME			///< simulated time of the trace at which the run starts
+			, unsigned int		dataset_length_ = 1							///< length of a dataset (bytes)
+			, unsigned int		nr_dataset_cycle_ = 1						///< number of datasets per port and process cycle
+			, input_end_mode	end_mode_ = INPUT_STOP						///< behaviour at the end of the input
 			);
 
+	~senenv_fifo_input( void );
+
 	SC_HAS_PROCESS( senenv_fifo_input );
 	void senenv_fifo_input_thread( void );
 	void read_data	( char* file_name										///< pointer to input file name
 					);
+	void write_trace_block	( void );
+	bool fill_port	( unsigned int port										///< index of the output port
+					);
+	void set_source	( unsigned int port,									///< index of the output port
+					  stimulus_source* source								///< source of the port, deleted by the module
+					);
+	void set_generators	( const generator_config& config					///< configuration of the generators
+						);
 
-	sc_core::sc_vector< sc_port< sc_fifo_out_if<datyp> > > out_ports;		///< vector of output port with access right to fifo channel
+	sc_core::sc_vector< sc_port< block_fifo_out_if<datyp> > > out_ports;	///< vector of output port with access right to the block fifo channel
 	
 private:
 	int					s_out_port_nr, s_counter;
 	sc_core::sc_time	glob_quantum;
 	char*				inputfile;
-	std::vector<datyp>	data_vector;
+	unsigned int		s_dataset_length, s_nr_dataset_cycle;
+	input_end_mode		s_end_mode;											///< behaviour at the end of the input
+	std::vector<stimulus_source*>		s_sources;							///< source of each port
+	std::vector< std::vector<datyp> >	s_last;								///< last dataset written to each port
+	std::vector<datyp>	s_data;												///< datasets of a process cycle
+	bool				s_trace_mode;										///< the input file is a trace file feeding all ports
+	trace_reader		s_trace;											///< reader of the trace file
+	sc_core::sc_time	s_start_time;										///< trace time at which the run starts
+	sc_core::sc_time	s_block_time;										///< timestamp of the pending block
+	sc_core::sc_time	s_trace_base;										///< simulated time at which the current pass of the trace started
+	std::vector<datyp>	s_block;											///< pending block of the trace
+	bool				s_block_valid;										///< there is a pending block
 
 };
 #endif
\ No newline at end of file
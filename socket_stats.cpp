@@ -0,0 +1,272 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "socket_stats.h"
+#include "constants.h"
+#include "reporting.h"
+#include "key_functions.h"
+#include <fstream>
+
+static const char *filename = "socket_stats.cpp";
+static const char *suffix	= "stats.json";
+
+//======================================================================
+/// @fn socket_stats
+//
+/// @brief constructor
+//
+//======================================================================
+socket_stats::socket_stats ( void )
+	: st_count		( 0 )
+	, st_bytes		( 0 )
+	, st_quantum	( 0 )
+	, st_busy_total	( 0 )
+	, st_quanta		( 0 )
+{
+	memset( st_histogram, 0, sizeof(st_histogram) );
+	memset( st_busy, 0, sizeof(st_busy) );
+	memset( st_busy_tag, 0, sizeof(st_busy_tag) );
+	memset( st_busy_histogram, 0, sizeof(st_busy_histogram) );
+}
+
+
+//======================================================================
+/// @fn init
+//
+/// @brief sets the name of the socket and the global quantum used to 
+///		assign the busy time of a transaction to a quantum
+//
+//======================================================================
+void socket_stats::init	( const std::string &socket_name,
+						  const sc_core::sc_time &glob_quantum )
+{
+	st_name		= socket_name;
+	st_quantum	= glob_quantum.value();
+}
+
+
+//======================================================================
+/// @fn record
+//
+/// @brief records a transaction which has been forwarded through the socket
+//
+/// @details
+///		The annotated delay of the transaction is the difference between the 
+///		delays after and before the call. The transaction is assigned to the
+///		quantum of the local time of its initiator. When a quantum takes over the
+///		entry of an older one in #st_busy, the busy time of the older one is folded
+///		into #st_busy_histogram. A transaction of a quantum which has already
+///		left the window only counts in the total busy time.
+//
+//======================================================================
+void socket_stats::record	( unsigned int nbytes,
+							  const sc_core::sc_time &delay_before,
+							  const sc_core::sc_time &delay_after	)
+{
+	sc_dt::uint64	before		= delay_before.value();
+	sc_dt::uint64	after		= delay_after.value();
+	sc_dt::uint64	annotated	= (after > before) ? (after - before) : 0;
+	sc_dt::uint64	q_idx;
+	unsigned int	slot;
+
+	st_count++;
+	st_bytes += nbytes;
+	st_histogram[bucket_index(annotated)]++;
+
+	if ( st_quantum > 0 )
+	{
+		q_idx			= (sc_core::sc_time_stamp().value() + before) / st_quantum;
+		slot			= (unsigned int)(q_idx % stats_busy_window);
+		st_busy_total	+= annotated;
+		if ( q_idx + 1 > st_quanta )
+		{
+			st_quanta = q_idx + 1;
+		}
+		if ( st_busy_tag[slot] > q_idx + 1 )
+		{
+			return;
+		}
+		if ( st_busy_tag[slot] < q_idx + 1 )
+		{
+			if ( st_busy_tag[slot] != 0 )
+			{
+				st_busy_histogram[bucket_index(st_busy[slot])]++;
+			}
+			st_busy_tag[slot]	= q_idx + 1;
+			st_busy[slot]		= 0;
+		}
+		st_busy[slot] += annotated;
+	}
+}
+
+
+//======================================================================
+/// @fn bucket_index
+//
+/// @brief determines the histogram bucket of a value
+//
+/// @details Values below #stats_sub_buckets have their own bucket. Above,
+///		the bucket is given by the position of the most significant bit and
+///		by the following #stats_sub_bits bits.
+//
+//======================================================================
+unsigned int socket_stats::bucket_index ( sc_dt::uint64 value )
+{
+	unsigned int	msb		= 0;
+	sc_dt::uint64	v		= value;
+
+	if ( value < stats_sub_buckets )
+	{
+		return (unsigned int)value;
+	}
+	if ( v >> 32 ) { v >>= 32; msb += 32; }
+	if ( v >> 16 ) { v >>= 16; msb += 16; }
+	if ( v >> 8  ) { v >>= 8;  msb += 8;  }
+	if ( v >> 4  ) { v >>= 4;  msb += 4;  }
+	if ( v >> 2  ) { v >>= 2;  msb += 2;  }
+	if ( v >> 1  ) {           msb += 1;  }
+
+	return	  (msb - stats_sub_bits + 1) * stats_sub_buckets
+			+ (unsigned int)((value >> (msb - stats_sub_bits)) & (stats_sub_buckets - 1));
+}
+
+
+//======================================================================
+/// @fn bucket_value
+//
+/// @brief determines the lowest value of a histogram bucket
+//
+//======================================================================
+sc_dt::uint64 socket_stats::bucket_value ( unsigned int idx )
+{
+	unsigned int	group	= idx / stats_sub_buckets;
+	unsigned int	sub		= idx % stats_sub_buckets;
+
+	if ( group == 0 )
+	{
+		return sub;
+	}
+	return (sc_dt::uint64)(stats_sub_buckets + sub) << (group - 1);
+}
+
+
+//======================================================================
+/// @fn write_json
+//
+/// @brief writes the statistics of the socket as a JSON object
+//
+/// @details The times are given in seconds. Only the non-empty buckets
+///		of the histograms are written, each one with its lowest value. The 
+///		busy times of the quanta still in the window are added to the copy
+///		of the busy histogram which is written.
+//
+//======================================================================
+void socket_stats::write_json	( std::ostream &os ) const
+{
+	double			resolution	= sc_core::sc_get_time_resolution().to_seconds();
+	sc_dt::uint64	busy[stats_buckets];
+	bool			first		= true;
+
+	os	<< "{ \"socket\": \"" << st_name << "\""
+		<< ", \"transactions\": " << st_count
+		<< ", \"bytes\": " << st_bytes
+		<< ", \"quantum_s\": " << st_quantum * resolution;
+
+	os << ", \"delay_histogram\": [";
+	for ( unsigned int i = 0; i < stats_buckets; i++ )
+	{
+		if ( st_histogram[i] == 0 )
+			continue;
+		os	<< (first ? "" : ", ")
+			<< "{ \"delay_s\": " << bucket_value(i) * resolution
+			<< ", \"count\": " << st_histogram[i] << " }";
+		first = false;
+	}
+	os << "]";
+
+	memcpy( busy, st_busy_histogram, sizeof(busy) );
+	for ( unsigned int i = 0; i < stats_busy_window; i++ )
+	{
+		if ( st_busy_tag[i] != 0 )
+		{
+			busy[bucket_index(st_busy[i])]++;
+		}
+	}
+	first = true;
+	os << ", \"busy_histogram\": [";
+	for ( unsigned int i = 0; i < stats_buckets; i++ )
+	{
+		if ( busy[i] == 0 )
+			continue;
+		os	<< (first ? "" : ", ")
+			<< "{ \"busy_s\": " << bucket_value(i) * resolution
+			<< ", \"quanta\": " << busy[i] << " }";
+		first = false;
+	}
+	os << "]";
+
+	os	<< ", \"quanta\": " << st_quanta
+		<< ", \"busy_total_s\": " << st_busy_total * resolution
+		<< ", \"utilization\": " << ( (st_quantum > 0 && st_quanta > 0) 
+										? (double)st_busy_total / (double)(st_quantum * st_quanta) : 0.0 )
+		<< " }";
+}
+
+
+//======================================================================
+/// @fn write_stats_file
+//
+/// @brief writes the statistics of all the sockets of an interconnect 
+///		component in a JSON file of the output directory
+//
+//======================================================================
+void write_stats_file	( const std::string &module_name,
+						  const std::vector<socket_stats> &stats )
+{
+	std::ostringstream	msg;
+	std::string			name		= module_name;
+	std::string			path		= std::string(OUTPUTDIR) + file_ops::build_filename(name, suffix);
+	std::ofstream		file		( path.c_str() );
+
+	if ( !file )
+	{
+		msg << "\t Statistics file " << path << " couldn't be opened!";
+		ERROR_LOG(filename, __FUNCTION__ , msg.str());
+		return;
+	}
+
+	file << "{ \"module\": \"" << module_name << "\", \"sockets\": [\n";
+	for ( unsigned int i = 0; i < stats.size(); i++ )
+	{
+		file << "  ";
+		stats[i].write_json(file);
+		file << ( (i + 1 < stats.size()) ? ",\n" : "\n" );
+	}
+	file << "] }\n";
+}
\ No newline at end of file
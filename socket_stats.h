@@ -0,0 +1,105 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file socket_stats.h
+//
+///  @brief This is for the traffic accounting on the sockets of the interconnect
+///		components.
+//
+///  @details
+///		For each socket, it counts the transactions and the transferred bytes, 
+///		records the annotated delays in a histogram of fixed size and sums up 
+///		the busy time of the socket per global quantum. The busy times of the 
+///		last #stats_busy_window quanta are summed up separately, the older ones
+///		are folded into a histogram of the same layout. <br>
+///		The histogram has the layout of an HDR histogram: the delays (in units
+///		of the time resolution) are grouped by their most significant bit and 
+///		each group is split into #stats_sub_buckets linear sub-buckets, so the 
+///		relative error of a recorded value is below 1/#stats_sub_buckets.
+///		Recording a transaction costs a few integer operations and no allocation,
+///		so the memory of the statistics doesn't grow with the simulated time.
+//		
+//==============================================================================
+
+#ifndef __SOCKET_STATS_H__
+#define __SOCKET_STATS_H__
+
+#include <systemc.h>
+#include <vector>
+#include <string>
+#include <ostream>
+
+const unsigned int	stats_sub_bits		=	3							;	///< number of bits for the linear sub-buckets of a histogram group
+const unsigned int	stats_sub_buckets	=	1 << stats_sub_bits			;	///< number of linear sub-buckets of a histogram group
+const unsigned int	stats_buckets		=	(64 - stats_sub_bits + 1) * stats_sub_buckets;	///< number of buckets of a histogram
+const unsigned int	stats_busy_window	=	4							;	///< number of recent quanta whose busy time is still summed up
+
+class socket_stats
+{
+
+// Member Methods  ====================================================
+public:
+
+	socket_stats	( void );
+
+	void init			( const std::string &socket_name,								///< name of the socket in the output
+						  const sc_core::sc_time &glob_quantum							///< time value for the global quantum
+						);
+
+	void record			( unsigned int nbytes,											///< number of transferred bytes
+						  const sc_core::sc_time &delay_before,							///< annotated delay before the call
+						  const sc_core::sc_time &delay_after							///< annotated delay after the call
+						);
+
+	void write_json		( std::ostream &os												///< output stream
+						) const;
+
+// Member Variables/Objects  ===================================================
+private:
+	std::string						st_name;											///< name of the socket
+	sc_dt::uint64					st_count;											///< number of transactions
+	sc_dt::uint64					st_bytes;											///< number of transferred bytes
+	sc_dt::uint64					st_histogram[stats_buckets];						///< histogram of the annotated delays
+	sc_dt::uint64					st_quantum;											///< global quantum in units of the time resolution
+	sc_dt::uint64					st_busy[stats_busy_window];							///< busy time of the recent quanta in units of the time resolution
+	sc_dt::uint64					st_busy_tag[stats_busy_window];						///< index + 1 of the quantum of each entry of #st_busy, 0 if unused
+	sc_dt::uint64					st_busy_histogram[stats_buckets];					///< histogram of the busy time of the older quanta
+	sc_dt::uint64					st_busy_total;										///< busy time of all quanta
+	sc_dt::uint64					st_quanta;											///< number of quanta up to the last one with a transaction
+
+	static unsigned int				bucket_index	( sc_dt::uint64 value );
+	static sc_dt::uint64			bucket_value	( unsigned int idx );
+};
+
+void write_stats_file	( const std::string &module_name,								///< sc module name of the interconnect component
+						  const std::vector<socket_stats> &stats						///< statistics of its sockets
+						);
+
+#endif /*__SOCKET_STATS_H__*/
@@ -0,0 +1,67 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "stimulus_source.h"
+
+
+//======================================================================
+/// @fn file_source
+//
+/// @brief constructor. It opens the file for streaming.
+//
+//======================================================================
+file_source::file_source ( const char* file_name )
+	: fs_name	( file_name )
+{
+	fs_reader.open( fs_name.c_str() );
+}
+
+
+//======================================================================
+/// @fn read
+//
+/// @brief delivers the next values of the file
+//
+//======================================================================
+size_t file_source::read ( datyp* data, size_t count )
+{
+	return fs_reader.read( data, count );
+}
+
+
+//======================================================================
+/// @fn rewind
+//
+/// @brief reopens the file at its beginning
+//
+//======================================================================
+bool file_source::rewind ( void )
+{
+	return fs_reader.open( fs_name.c_str() );
+}
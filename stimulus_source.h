@@ -0,0 +1,84 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file stimulus_source.h
+//
+///  @brief This is the interface of the data sources feeding the output ports of 
+///		the senenv_fifo_input module
+//
+///  @details
+///		A source delivers the data of one port as a stream. The module asks each 
+///		source for the datasets of a process cycle and handles the end of the 
+///		input according to its #input_end_mode, using rewind() for INPUT_LOOP. <br>
+///		file_source streams a byte file with a stream_reader, which decompresses
+///		gzip and zlib files when USE_ZLIB is defined.
+//		
+//==============================================================================
+
+#ifndef __STIMULUS_SOURCE_H__
+#define __STIMULUS_SOURCE_H__
+
+#include <string>
+
+#include "constants.h"
+#include "stream_reader.h"
+
+class stimulus_source
+{
+public:
+
+	virtual ~stimulus_source	( void ) {}
+
+	/// copies up to count values into data, returns the number of values copied
+	virtual size_t read			( datyp* data, size_t count ) = 0;
+
+	/// restarts the source from the beginning, returns false if it can't
+	virtual bool rewind			( void ) = 0;
+};
+
+
+class file_source : public stimulus_source
+{
+public:
+
+	file_source			( const char* file_name								///< input file name, relative to INPUTDIR
+						);
+
+	size_t read			( datyp* data, size_t count );
+
+	bool rewind			( void );
+
+private:
+
+	std::string			fs_name;											///< input file name
+	stream_reader		fs_reader;											///< streaming reader of the file
+};
+
+#endif /*__STIMULUS_SOURCE_H__*/
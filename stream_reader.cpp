@@ -0,0 +1,458 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "stream_reader.h"
+#include "reporting.h"
+
+static const char *filename = "stream_reader.cpp";
+
+
+//======================================================================
+/// @fn stream_reader
+//
+/// @brief constructor
+//
+//======================================================================
+stream_reader::stream_reader ( unsigned int chunk_size, unsigned int chunk_count )
+	: sr_chunks		( std::max(chunk_count, 2u), std::vector<datyp>(chunk_size) )
+	, sr_fill		( std::max(chunk_count, 2u), 0 )
+	, sr_head		( 0 )
+	, sr_ready		( 0 )
+	, sr_reading	( false )
+	, sr_pos		( 0 )
+	, sr_skip		( 0 )
+	, sr_finished	( true )
+	, sr_failed		( false )
+	, sr_stop		( false )
+	, sr_compressed	( false )
+	, sr_in_stream	( false )
+{
+#ifdef USE_ZLIB
+	memset( &sr_zs, 0, sizeof(sr_zs) );
+#endif
+}
+
+
+//======================================================================
+/// @fn ~stream_reader
+//
+/// @brief destructor
+//
+/// @details It stops the prefetch thread and closes the file.
+//
+//======================================================================
+stream_reader::~stream_reader ( void )
+{
+	close();
+}
+
+
+//======================================================================
+/// @fn open
+//
+/// @brief opens the input file and starts the prefetch thread
+//
+/// @details The file is opened in binary mode, so that every byte of it
+///		is delivered, whitespaces included. The reading starts at the given
+///		offset, so that the beginning of the file doesn't have to be read. 
+///		For a compressed file, the offset refers to the decompressed bytes,
+///		which are skipped by the prefetch thread.
+//
+/// @retval false if the file couldn't be opened
+//
+//======================================================================
+bool stream_reader::open ( const char* file_name, sc_dt::uint64 offset )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(INPUTDIR) + std::string(file_name);
+
+	close();
+
+	if ( !open_file(strfname) )
+	{
+#ifdef USE_ZLIB
+		if ( !open_file(strfname + ".gz") )
+#endif
+		{
+			msg << "i couldn't open file " << strfname << "!";
+			ERROR_LOG(filename, __FUNCTION__, msg.str());
+			return false;
+		}
+	}
+
+	sr_skip = 0;
+	if ( sr_compressed )
+	{
+#ifdef USE_ZLIB
+		memset( &sr_zs, 0, sizeof(sr_zs) );
+		sr_zin.resize( sr_chunks[0].size() );
+		if ( inflateInit2(&sr_zs, 15 + 32) != Z_OK )				// 15 + 32: zlib or gzip header, detected automatically
+		{
+			msg << "i couldn't initialize the decompression of file " << sr_name << "!";
+			ERROR_LOG(filename, __FUNCTION__, msg.str());
+			sr_file.close();
+			sr_compressed = false;
+			return false;
+		}
+		sr_skip			= offset;
+		sr_in_stream	= true;
+#else
+		msg << "file " << sr_name << " is compressed, define USE_ZLIB to read it!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		sr_file.close();
+		sr_compressed = false;
+		return false;
+#endif
+	}
+	else
+	{
+		sr_file.seekg( std::streamoff(offset) );
+	}
+
+	sr_head			= 0;
+	sr_ready		= 0;
+	sr_reading		= false;
+	sr_pos			= 0;
+	sr_finished		= false;
+	sr_failed		= false;
+	sr_stop			= false;
+	sr_thread		= std::thread( &stream_reader::prefetch, this );
+	return true;
+}
+
+
+//======================================================================
+/// @fn open_file
+//
+/// @brief opens a file and checks its first bytes for a compression header
+//
+/// @details A gzip header is always recognized. A zlib header is only 
+///		recognized with USE_ZLIB and for the suffixes ".z" and ".zz", since 
+///		its two bytes also start many raw files. A header asking for a preset
+///		dictionary (FDICT) isn't accepted. Any other file is read as it is.
+//
+/// @retval false if the file doesn't exist
+//
+//======================================================================
+bool stream_reader::open_file ( const std::string& file_name )
+{
+	unsigned char	magic[2]	= { 0, 0 };
+
+	sr_file.clear();
+	sr_file.open( file_name.c_str(), std::ifstream::binary );
+	if ( !sr_file.is_open() )
+	{
+		return false;
+	}
+	sr_file.read( reinterpret_cast<char*>(magic), 2 );
+	bool complete = sr_file.gcount() == 2;
+	sr_file.clear();
+	sr_file.seekg( 0 );
+
+	sr_name			= file_name;
+	sr_compressed	= complete && magic[0] == 0x1f && magic[1] == 0x8b;
+#ifdef USE_ZLIB
+	size_t	dot		= file_name.find_last_of( '.' );
+	bool	zlib	= dot != std::string::npos && ( file_name.substr(dot) == ".z" || file_name.substr(dot) == ".zz" );
+	sr_compressed	= sr_compressed || ( zlib && complete && (magic[0] & 0x0f) == 8 && (magic[0] >> 4) <= 7 
+										 && (magic[1] & 0x20) == 0 && ((magic[0] << 8) | magic[1]) % 31 == 0 );
+#endif
+	return true;
+}
+
+
+//======================================================================
+/// @fn close
+//
+/// @brief stops the prefetch thread and closes the input file
+//
+//======================================================================
+void stream_reader::close ( void )
+{
+	if ( sr_thread.joinable() )
+	{
+		{
+			std::lock_guard<std::mutex> lock(sr_mutex);
+			sr_stop = true;
+		}
+		sr_cv.notify_all();
+		sr_thread.join();
+	}
+	if ( sr_file.is_open() )
+	{
+		sr_file.close();
+	}
+#ifdef USE_ZLIB
+	if ( sr_compressed )
+	{
+		inflateEnd( &sr_zs );
+	}
+#endif
+	sr_compressed	= false;
+	sr_ready		= 0;
+	sr_reading		= false;
+	sr_finished		= true;
+}
+
+
+//======================================================================
+/// @fn next
+//
+/// @brief delivers the next value of the input file
+//
+/// @details When the head buffer is exhausted, it is handed back to the
+///		prefetch thread and the next filled buffer is taken.
+//
+/// @retval false if the end of the file has been reached
+//
+//======================================================================
+bool stream_reader::next ( datyp& value )
+{
+	if ( !sr_reading || sr_pos >= sr_fill[sr_head] )
+	{
+		if ( !swap_buffers() )
+		{
+			return false;
+		}
+	}
+	value = sr_chunks[sr_head][sr_pos++];
+	return true;
+}
+
+
+//======================================================================
+/// @fn read
+//
+/// @brief delivers the next values of the input file
+//
+/// @retval number of values copied, less than count at the end of the file
+//
+//======================================================================
+size_t stream_reader::read ( datyp* data, size_t count )
+{
+	size_t	done	= 0;
+
+	while ( done < count )
+	{
+		if ( !sr_reading || sr_pos >= sr_fill[sr_head] )
+		{
+			if ( !swap_buffers() )
+			{
+				break;
+			}
+		}
+		size_t n = std::min( count - done, sr_fill[sr_head] - sr_pos );
+		memcpy( data + done, &sr_chunks[sr_head][sr_pos], n * sizeof(datyp) );
+		sr_pos	+= n;
+		done	+= n;
+	}
+	return done;
+}
+
+
+//======================================================================
+/// @fn is_compressed
+//
+/// @retval true if the open file is decompressed while reading
+//
+//======================================================================
+bool stream_reader::is_compressed ( void ) const
+{
+	return sr_compressed;
+}
+
+
+//======================================================================
+/// @fn swap_buffers
+//
+/// @brief hands the consumed buffer back and waits for the next filled one
+//
+/// @details The simulation only waits here when the prefetch thread is
+///		behind, i.e. when all the buffers filled in advance are consumed.
+///		A decompression error is reported once, at the end of the valid data.
+//
+/// @retval false if there is no more data
+//
+//======================================================================
+bool stream_reader::swap_buffers ( void )
+{
+	std::unique_lock<std::mutex> lock(sr_mutex);
+
+	if ( sr_reading )
+	{
+		sr_head		= (sr_head + 1) % sr_chunks.size();
+		sr_ready--;
+		sr_reading	= false;
+		sr_cv.notify_all();
+	}
+	while ( sr_ready == 0 && !sr_finished )
+	{
+		sr_cv.wait(lock);
+	}
+	if ( sr_ready == 0 )
+	{
+		if ( sr_failed )
+		{
+			std::ostringstream	msg;
+			msg << "file " << sr_name << " is corrupted, the decompression stopped!";
+			ERROR_LOG(filename, __FUNCTION__, msg.str());
+			sr_failed = false;
+		}
+		return false;
+	}
+
+	sr_reading	= true;
+	sr_pos		= 0;
+	return sr_fill[sr_head] > 0;
+}
+
+
+//======================================================================
+/// @fn prefetch
+//
+/// @brief body of the prefetch thread
+//
+/// @details It fills the free buffers of the ring in advance and stops 
+///		after the last (short) chunk of the file.
+//
+//======================================================================
+void stream_reader::prefetch ( void )
+{
+	std::unique_lock<std::mutex> lock(sr_mutex);
+
+	while ( true )
+	{
+		while ( sr_ready == sr_chunks.size() && !sr_stop )
+		{
+			sr_cv.wait(lock);
+		}
+		if ( sr_stop )
+		{
+			return;
+		}
+
+		// the tail buffer belongs to this thread until it is counted as ready
+		size_t	tail	= (sr_head + sr_ready) % sr_chunks.size();
+		bool	failed	= false;
+		lock.unlock();
+		size_t count = fill( &sr_chunks[tail][0], sr_chunks[tail].size(), failed );
+		lock.lock();
+
+		sr_fill[tail]	= count;
+		sr_ready++;
+		if ( count < sr_chunks[tail].size() )
+		{
+			sr_finished	= true;
+			sr_failed	= failed;
+		}
+		sr_cv.notify_all();
+
+		if ( sr_finished )
+		{
+			return;
+		}
+	}
+}
+
+
+//======================================================================
+/// @fn fill
+//
+/// @brief reads or decompresses the next bytes of the file into a buffer
+//
+/// @details Called by the prefetch thread only. Concatenated gzip members
+///		are decompressed one after the other. A compressed file which ends
+///		inside a stream is truncated and reported as failed.
+//
+/// @retval number of bytes written, less than count at the end of the file
+//
+//======================================================================
+size_t stream_reader::fill ( datyp* data, size_t count, bool& failed )
+{
+#ifdef USE_ZLIB
+	if ( sr_compressed )
+	{
+		size_t	done	= 0;
+
+		while ( done < count )
+		{
+			if ( sr_zs.avail_in == 0 )
+			{
+				sr_file.read( reinterpret_cast<char*>(&sr_zin[0]), std::streamsize(sr_zin.size()) );
+				sr_zs.next_in	= &sr_zin[0];
+				sr_zs.avail_in	= uInt(sr_file.gcount());
+				if ( sr_zs.avail_in == 0 )
+				{
+					failed = sr_in_stream;
+					break;
+				}
+			}
+
+			// the bytes before the offset are decompressed into the buffer and overwritten
+			size_t	want	= count - done;
+			if ( sr_skip > 0 && sr_skip < want )
+			{
+				want = size_t(sr_skip);
+			}
+			sr_zs.next_out	= data + done;
+			sr_zs.avail_out	= uInt(want);
+			int		ret		= inflate( &sr_zs, Z_NO_FLUSH );
+			size_t	written	= want - sr_zs.avail_out;
+
+			if ( sr_skip > 0 )
+			{
+				sr_skip -= written;
+			}
+			else
+			{
+				done	+= written;
+			}
+
+			sr_in_stream = ( ret != Z_STREAM_END );
+			if ( ret == Z_STREAM_END )
+			{
+				inflateReset( &sr_zs );
+			}
+			else if ( ret != Z_OK && ret != Z_BUF_ERROR )
+			{
+				failed = true;
+				break;
+			}
+		}
+		return done;
+	}
+#else
+	(void)failed;
+#endif
+	sr_file.read( reinterpret_cast<char*>(data), std::streamsize(count) );
+	return size_t(sr_file.gcount());
+}
@@ -0,0 +1,133 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file stream_reader.h
+//
+///  @brief This is the streaming reader for the input files of the model
+//
+///  @details
+///		The input file is read in chunks of #stream_chunk_size bytes into a ring
+///		of #stream_chunk_count buffers. While the simulation consumes one buffer,
+///		a prefetch thread fills the other ones in advance, so that the memory used
+///		doesn't depend on the length of the file and the simulation can start 
+///		immediately. <br>
+///		With USE_ZLIB defined (constants.h), gzip files are recognized by their
+///		magic bytes and decompressed by the prefetch thread, so that the simulation
+///		only sees the decompressed bytes. Raw zlib streams have no reliable magic:
+///		they are only decompressed for the suffixes ".z" and ".zz". If the file 
+///		can't be found, its name with the suffix ".gz" is tried. Without USE_ZLIB,
+///		the files are read as they are and gzip files are rejected. <br>
+///		The prefetch thread only accesses the file and the free buffers; it 
+///		never calls the SystemC kernel.
+//		
+//==============================================================================
+
+#ifndef __STREAM_READER_H__
+#define __STREAM_READER_H__
+
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "constants.h"
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+class stream_reader
+{
+
+// Member Methods  ====================================================
+public:
+
+	stream_reader	( unsigned int chunk_size = stream_chunk_size						///< size of each buffer (bytes)
+					, unsigned int chunk_count = stream_chunk_count						///< number of buffers, at least 2
+					);
+
+	~stream_reader	( void );
+
+	bool open		( const char* file_name											///< input file name, relative to INPUTDIR
+					, sc_dt::uint64 offset = 0										///< position of the first (decompressed) byte to be read
+					);
+
+	void close		( void );
+
+	bool next		( datyp& value													///< ref to the next value of the file
+					);
+
+	size_t read		( datyp* data													///< pointer to the destination buffer
+					, size_t count													///< number of values to be read
+					);
+
+	bool is_compressed	( void ) const;
+
+private:
+
+	bool open_file	( const std::string& file_name									///< full file name
+					);
+
+	void prefetch	( void );
+
+	size_t fill		( datyp* data													///< pointer to the buffer to be filled
+					, size_t count													///< size of the buffer
+					, bool& failed													///< set if the decompression failed
+					);
+
+	bool swap_buffers	( void );
+
+// Member Variables/Objects  ===================================================
+private:
+
+	std::ifstream				sr_file;										///< input file
+	std::vector< std::vector<datyp> >	sr_chunks;								///< ring of buffers
+	std::vector<size_t>			sr_fill;										///< number of valid bytes in each buffer
+	size_t						sr_head;										///< buffer consumed by the simulation
+	size_t						sr_ready;										///< number of filled buffers, the consumed one included
+	bool						sr_reading;										///< the simulation holds the head buffer
+	size_t						sr_pos;											///< read position in the head buffer
+	sc_dt::uint64				sr_skip;										///< decompressed bytes to be skipped before the first buffer
+	bool						sr_finished;									///< the prefetch thread reached the end of the file
+	bool						sr_failed;										///< the decompression failed, reported by the simulation thread
+	bool						sr_stop;										///< requests the prefetch thread to stop
+	bool						sr_compressed;									///< the file is decompressed
+	bool						sr_in_stream;									///< the decompression is inside a compressed stream, i.e. its end is missing
+	std::string					sr_name;										///< full name of the input file
+	std::thread					sr_thread;										///< prefetch thread
+	std::mutex					sr_mutex;
+	std::condition_variable		sr_cv;
+#ifdef USE_ZLIB
+	z_stream					sr_zs;											///< decompression state
+	std::vector<unsigned char>	sr_zin;											///< compressed input buffer
+#endif
+};
+#endif /*__STREAM_READER_H__*/
@@ -118,9 +118,18 @@ tlm::tlm_sync_enum target_actuator::nb_transport_fw (	tlm::tlm_generic_payload&
 	return tlm::TLM_ACCEPTED;
 }
 
+//======================================================================
+/// @fn transport_dbg
+//
+/// @brief implementation of the debug transport for zero time accesses
+///		on the Actuator memory. 
+//
+/// @details The decision of SEE isn't executed on a debug write.
+//
+//======================================================================
 unsigned int target_actuator::transport_dbg (	tlm::tlm_generic_payload& tObj 			 	///< ref to transaction object
 											)
 {
-	return 0;
+	return act_mem.debug_operation(tObj);
 }
 
@@ -85,7 +85,6 @@ public:
 											sc_core::sc_time& delay				///< ref to time delay 
 										);
     
-	/// Unsused interface method
 	unsigned int transport_dbg	(	tlm::tlm_generic_payload& tObj 			 	///< ref to transaction object
 								);
 
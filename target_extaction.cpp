@@ -112,11 +112,20 @@ tlm::tlm_sync_enum target_extaction::nb_transport_fw(	int id,								///< actuat
 	return tlm::TLM_ACCEPTED;
 }
 
+//======================================================================
+/// @fn transport_dbg
+//
+/// @brief implementation of the debug transport for zero time accesses
+///		on the ExtAction's memory. 
+//
+/// @details No data is written on the fifo channel on a debug write.
+//
+//======================================================================
 unsigned int target_extaction::transport_dbg(	int id,										///< actuator socket id through which the call arrived
 												tlm::tlm_generic_payload& tObj				///< ref to transaction object
 											)
 {
-	return 0;
+	return extact_mem.debug_operation(tObj);
 }
 
 
@@ -130,6 +139,6 @@ unsigned int target_extaction::transport_dbg(	int id,										///< actuator soc
 //======================================================================
 void target_extaction::execute_action(void)
 {
-	/*sc_dt::uchar out = 'E'		;
-	extact_outport->write(out)	;*/
+	/*sc_dt::uchar out = 'E'				;
+	extact_outport->nb_write_msg(&out, 1)	;*/
 }
\ No newline at end of file
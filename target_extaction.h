@@ -48,6 +48,7 @@
 
 #include "constants.h"
 #include "memory.h"
+#include "message_fifo.h"
 
 class target_extaction:	public sc_module
 {
@@ -83,7 +84,6 @@ public:
 											sc_core::sc_time& delay				///< ref to time delay 
 										);
     
-	/// Unsused interface method
 	unsigned int transport_dbg	(	int id,										///< actuator socket id through which the call came in
 									tlm::tlm_generic_payload& tObj 			 	///< ref to transaction object
 								);
@@ -92,7 +92,7 @@ public:
 
 // Variable and Object Declarations ============================================
 	tlm_utils::simple_target_socket_tagged<target_extaction, buswidth4>	extact_tsocket;		///< tagged simple  target socket for communication with ic4
-	sc_core::sc_port< sc_fifo_out_if<sc_dt::uchar> >			extact_outport;				///< output port for with write access rights on fifo channel; for sendind data to other nodes
+	sc_core::sc_port< message_fifo_out_if >					extact_outport;				///< output port for with write access rights on the message fifo channel; for sendind data to other nodes
 
 	
 private:
@@ -30,6 +30,7 @@
 #define SC_INCLUDE_DYNAMIC_PROCESSES
 #include <cstdio>
 #include <stdlib.h>
+#include <algorithm>
 #include <systemc.h>
 
 #include "target_sae.h"
@@ -52,6 +53,10 @@ unsigned int ic1_initiator_idx				=	0;
 ///		It initializes the vector <b> <em> sae_tsocket_array </em> </b> 
 ///		(private member) with the number of its initiators stored in the 
 ///		constant #sae_initiator_number.
+///		<br> In the flattened topology, it also initializes the vector
+///		<b> <em> sae_direct_tsocket_array </em> </b> with one socket per sensor
+///		initiator and precomputes the size of their memory area, which is the 
+///		same as the one used in interconnect1::address_mapping().
 ///		<br> It registers the callbacks for the use of convenience sockets
 ///		defined here.
 //
@@ -63,14 +68,21 @@ target_sae::target_sae
 						, unsigned int              memory_width			///< memory width (bytes)
 						, const sc_core::sc_time    read_latency			///< read response delay 
 						, const sc_core::sc_time    write_latency			///< write response delay
+						, const unsigned int        direct_initiator_number	///< number of sensor initiators bound directly (flattened topology)
+						, const sc_core::sc_time    hop_latency				///< fixed delay of the bypassed interconnect hop
 						)	
 						:	
 						  sae_id					( ID			)
 						, sae_mem_size				( memory_size	)
 						, sae_read_latency			( read_latency	)
 						, sae_write_latency			( write_latency	)
+						, sae_hop_latency			( hop_latency	)
+						, sae_subarea_size			( direct_initiator_number ? (unsigned int)(memory_size / direct_initiator_number) : 0 )
 						, sae_mem_width				( memory_width	)
 						, sae_initiator_nr			( sae_initiator_number	)
+						, sae_sync					( 0				)
+						, sae_cycle_area				( 0				)
+						, sae_cycle_missing			( 0				)
 						, sae_mem 
 						(	  ID 
 							, read_latency									// delay for reads
@@ -79,6 +91,7 @@ target_sae::target_sae
 							, memory_width									// memory width (bytes)
 						)
 						, sae_tsocket_array("TSOCKET")
+						, sae_direct_tsocket_array("DIRECT_TSOCKET")
 { 
 	sae_tsocket_array.init(sae_initiator_number);
 	for (unsigned int i = 0; i < sae_initiator_number; i++)
@@ -88,6 +101,15 @@ target_sae::target_sae
 		sae_tsocket_array[i].register_nb_transport_fw		( this, &target_sae::nb_transport_fw,		i	);
 		sae_tsocket_array[i].register_transport_dbg			( this, &target_sae::transport_dbg,			i	);
     }
+
+	sae_direct_tsocket_array.init(direct_initiator_number);
+	for (unsigned int i = 0; i < direct_initiator_number; i++)
+    {
+		sae_direct_tsocket_array[i].register_b_transport		( this, &target_sae::direct_b_transport,	i	);
+		sae_direct_tsocket_array[i].register_get_direct_mem_ptr	( this, &target_sae::get_direct_mem_ptr,	i	);
+		sae_direct_tsocket_array[i].register_nb_transport_fw	( this, &target_sae::nb_transport_fw,		i	);
+		sae_direct_tsocket_array[i].register_transport_dbg		( this, &target_sae::direct_transport_dbg,	i	);
+    }
 }
 
 
@@ -124,6 +146,7 @@ void target_sae::b_transport (	int id,
 				return;
 			}
 			sae_mem.operation(ic1_id_nr, tObj, delay);
+			count_cycle_write(tObj);
 			break;
 	}
 	
@@ -151,10 +174,153 @@ tlm::tlm_sync_enum target_sae::nb_transport_fw( int id,
 	return tlm::TLM_ACCEPTED;
 }
 
+//======================================================================
+/// @fn transport_dbg
+//
+/// @brief implementation of the debug transport for zero time accesses
+///		on the SAE memory
+//
+/// @details Unlike b_transport, it doesn't restrict the access rights of
+///		the initiators, so that the whole memory can be inspected or
+///		modified through any socket.
+//
+//======================================================================
 unsigned int target_sae::transport_dbg( int id,
 										tlm::tlm_generic_payload& tObj )
 {
-	return 0;
+	return sae_mem.debug_operation(tObj);
+}
+
+
+//======================================================================
+/// @fn direct_b_transport
+//
+/// @brief implementation of the blocking transport for the sensor 
+///		initiators bound directly to the SAE (flattened topology)
+//
+/// @details It does the work of interconnect1::b_transport() followed by
+///		the IC1 branch of b_transport() in a single call: the address is 
+///		shifted by the precomputed offset of the initiator's memory area and
+///		the fixed hop latency is added to the delay. The simulated timing is
+///		thus identical to the routed topology.
+//
+/// @see interconnect1::address_mapping()
+//
+//======================================================================
+void target_sae::direct_b_transport (	int id,
+										tlm::tlm_generic_payload& tObj, 
+										sc_core::sc_time& delay				)
+{	
+	if ( tObj.get_command() == tlm::TLM_READ_COMMAND )
+	{
+		tObj.set_response_status(tlm::TLM_COMMAND_ERROR_RESPONSE);
+		msg << "this component has write-access only!";
+		ERROR_LOG(filename, __FUNCTION__ , msg.str());
+		return;
+	}
+	tObj.set_address( id * sae_subarea_size + tObj.get_address() );
+	delay += sae_hop_latency;
+	sae_mem.operation(ic1_id_nr, tObj, delay);
+	count_cycle_write(tObj);
+}
+
+
+//======================================================================
+/// @fn direct_transport_dbg
+//
+/// @brief debug transport for the sensor initiators bound directly to 
+///		the SAE (flattened topology)
+//
+/// @details The address is mapped like in direct_b_transport() and
+///		restored afterwards.
+//
+//======================================================================
+unsigned int target_sae::direct_transport_dbg( int id,
+											   tlm::tlm_generic_payload& tObj )
+{
+	sc_dt::uint64	adr		= tObj.get_address();
+	unsigned int	count;
+
+	tObj.set_address( id * sae_subarea_size + adr );
+	count = sae_mem.debug_operation(tObj);
+	tObj.set_address( adr );
+	return count;
+}
+
+
+//======================================================================
+/// @fn track_cycles
+//
+/// @brief enables the tracking of the write completion of each cycle
+//
+/// @details The memory is divided in the areas of the sensor initiators
+///		like in interconnect1::address_mapping(). A cycle is complete when 
+///		each initiator has written its whole area since the completion of the 
+///		last cycle. The sae then sets node_sync::sae_cycle_complete and notifies 
+///		node_sync::sae_cycle_ev once, so that LModel starts reading the cycle 
+///		without polling the memory.
+//
+/// @see count_cycle_write()
+//
+//======================================================================
+void target_sae::track_cycles( node_sync& sync, unsigned int initiator_number )
+{
+	if ( initiator_number == 0 )
+		return;
+
+	sae_sync			= &sync;
+	sae_cycle_area		= sae_mem_size / initiator_number;
+	sae_cycle_missing	= initiator_number;
+	sae_cycle_bytes.assign( initiator_number, 0 );
+}
+
+
+//======================================================================
+/// @fn count_cycle_write
+//
+/// @brief counts the bytes of a successful sensor write on the areas of 
+///		the initiators and signals the completion of the cycle
+//
+/// @details A write may cover several areas, e.g. a burst committed by 
+///		IC1 in the coalescing mode. Every byte of the transaction is counted,
+///		so IC1 commits only the ranges actually written by the initiators
+///		and never the gaps between them. The notification is a delta notification,
+///		so that LModel reads the cycle after the last write of the current
+///		delta cycle.
+//
+/// @see track_cycles()
+//
+//======================================================================
+void target_sae::count_cycle_write( tlm::tlm_generic_payload& tObj )
+{
+	sc_dt::uint64	adr		= tObj.get_address();
+	sc_dt::uint64	end		= adr + tObj.get_data_length();
+	unsigned int	area, count;
+
+	if ( !sae_sync || !tObj.is_response_ok() )
+		return;
+
+	while ( adr < end )
+	{
+		area	= (unsigned int)(adr / sae_cycle_area);
+		if ( area >= sae_cycle_bytes.size() )
+			break;
+		count	= (unsigned int)( std::min( end, (sc_dt::uint64)(area + 1) * sae_cycle_area ) - adr );
+		if ( sae_cycle_bytes[area] < sae_cycle_area && sae_cycle_bytes[area] + count >= sae_cycle_area )
+		{
+			sae_cycle_missing--;
+		}
+		sae_cycle_bytes[area] += count;
+		adr += count;
+	}
+
+	if ( sae_cycle_missing == 0 )
+	{
+		sae_cycle_bytes.assign( sae_cycle_bytes.size(), 0 );
+		sae_cycle_missing					= (unsigned int)sae_cycle_bytes.size();
+		sae_sync->sae_cycle_complete		= true;
+		sae_sync->sae_cycle_ev.notify( sc_core::SC_ZERO_TIME );
+	}
 }
 
 
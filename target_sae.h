@@ -51,6 +51,8 @@
 #include <tlm.h>									
 #include <tlm_utils\simple_target_socket.h>	
 
+#include <vector>
+
 #include "constants.h"
 #include "memory.h"
 
@@ -67,6 +69,8 @@ public:
 		, unsigned int              memory_width								///< memory width (bytes)
 		, const sc_core::sc_time    read_latency								///< read response delay 
 		, const sc_core::sc_time    write_latency								///< write response delay 
+		, const unsigned int        direct_initiator_number						///< number of sensor initiators bound directly (flattened topology)
+		, const sc_core::sc_time    hop_latency									///< fixed delay of the bypassed interconnect hop
 	);
 
 	
@@ -89,28 +93,54 @@ public:
 											sc_core::sc_time& delay				///< ref to time delay 
 										);
 
-	/// Unused interface method
 	unsigned int transport_dbg	(	int id,										///< sae socket id through which the call came in
 									tlm::tlm_generic_payload& tObj 			 	///< ref to transaction object
 								);
 
+	//interface methods of the direct sockets (flattened topology)
+	void direct_b_transport		(	int id,										///< direct socket id = index of the sensor initiator
+									tlm::tlm_generic_payload& tObj, 			///< ref to transaction object
+									sc_core::sc_time& delay						///< ref to time delay
+								);
+
+	unsigned int direct_transport_dbg	(	int id,								///< direct socket id = index of the sensor initiator
+											tlm::tlm_generic_payload& tObj 		///< ref to transaction object
+										);
+
 	void set_target_idx_for_invalidate_ptr	(	const unsigned int& start_addr	///< const ref to transaction start address
 											,	const unsigned int& end_addr	///< const ref to transaction end address
 											);
 	
 // Variable and Object Declarations ============================================
 	sc_core::sc_vector< tlm_utils::simple_target_socket_tagged<target_sae, buswidth1> > sae_tsocket_array;	///< vector of tagged simple target socket for communication with iC4 and LM.
+	sc_core::sc_vector< tlm_utils::simple_target_socket_tagged<target_sae, buswidth1> > sae_direct_tsocket_array;	///< vector of tagged simple target socket for the sensor initiators bound without IC1
 	
 	unsigned int		sae_mem_size						;					///< memory's size of sae
 
 	unsigned int get_id(void);
 
+	/// enables the dirty tracking of the sae memory in slots of slot_size bytes
+	void track_dirty(unsigned int slot_size)		{ sae_mem.track_dirty(slot_size); }
+
+	void track_cycles	(	node_sync& sync,									///< events of the node, notified at the completion of a cycle
+							unsigned int initiator_number						///< number of sensor initiators sharing the memory
+						);
+
 private:
 	const unsigned int	sae_initiator_nr					;
 	unsigned int		sae_id, sae_mem_width				;
 	memory				sae_mem								;					// memory
 	sc_core::sc_time	sae_read_latency					;
 	sc_core::sc_time	sae_write_latency					;
+	sc_core::sc_time	sae_hop_latency						;
+	unsigned int		sae_subarea_size					;					// size of the memory area allocated to each direct initiator
+	node_sync*			sae_sync							;					// events of the node, 0 without cycle tracking
+	unsigned int		sae_cycle_area						;					// size of the memory area of an initiator in the cycle tracking
+	unsigned int		sae_cycle_missing					;					// number of initiators which haven't completed their area in the current cycle
+	std::vector<unsigned int>	sae_cycle_bytes				;					// bytes written in the current cycle on the area of each initiator
+
+	void count_cycle_write	(	tlm::tlm_generic_payload& tObj						// ref to the completed write transaction
+							);
 
 	
 };
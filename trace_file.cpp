@@ -0,0 +1,492 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cctype>
+
+#include "trace_file.h"
+#include "reporting.h"
+
+static const char			*filename			= "trace_file.cpp";
+static const char			trace_magic[4]		= { 'P', 'S', 'T', 'R' };	///< first bytes of a trace file
+static const unsigned int	trace_version		= 1;
+static const sc_dt::uint64	trace_header_size	= 48;						///< size of the header in the file (bytes)
+
+
+//======================================================================
+/// @fn put_uint
+//
+/// @brief writes the given number of bytes of a value in little-endian order
+//
+//======================================================================
+static void put_uint ( std::ostream& os, sc_dt::uint64 value, unsigned int bytes )
+{
+	for ( unsigned int i = 0; i < bytes; i++ )
+	{
+		os.put( char( (value >> (8*i)) & 0xff ) );
+	}
+}
+
+
+//======================================================================
+/// @fn get_uint
+//
+/// @brief decodes a little-endian value of the given number of bytes
+//
+//======================================================================
+static sc_dt::uint64 get_uint ( const unsigned char* bytes, unsigned int count )
+{
+	sc_dt::uint64	value	= 0;
+
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		value |= sc_dt::uint64(bytes[i]) << (8*i);
+	}
+	return value;
+}
+
+
+//======================================================================
+/// @fn read_uint
+//
+/// @brief reads a little-endian value of the given number of bytes
+//
+//======================================================================
+static sc_dt::uint64 read_uint ( std::istream& is, unsigned int bytes )
+{
+	unsigned char	buf[8];
+
+	is.read( reinterpret_cast<char*>(buf), bytes );
+	return get_uint( buf, bytes );
+}
+
+
+//======================================================================
+/// @fn to_ps
+//
+/// @brief converts a time value in picoseconds
+//
+//======================================================================
+static sc_dt::uint64 to_ps ( const sc_core::sc_time& time )
+{
+	return sc_dt::uint64( time.to_seconds() * 1e12 + 0.5 );
+}
+
+
+//======================================================================
+/// @fn trace_reader
+//
+/// @brief constructor
+//
+//======================================================================
+trace_reader::trace_reader ( void )
+	: tr_block_size	( 0 )
+	, tr_next		( 0 )
+{
+	memset( &tr_header, 0, sizeof(tr_header) );
+}
+
+
+//======================================================================
+/// @fn open
+//
+/// @brief opens a trace file, reads its header and positions the reader
+///		on the first block.
+//
+/// @retval false if the file couldn't be opened or isn't a trace file
+//
+//======================================================================
+bool trace_reader::open ( const char* file_name )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(INPUTDIR) + std::string(file_name);
+	char				magic[4];
+
+	close();
+	tr_file.clear();
+	tr_file.open( strfname.c_str(), std::ifstream::binary );
+	if ( !tr_file.is_open() )
+	{
+		msg << "i couldn't open file " << strfname << "!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		return false;
+	}
+
+	tr_file.read( magic, 4 );
+	if ( !tr_file.good() || memcmp(magic, trace_magic, 4) != 0 || read_uint(tr_file, 4) != trace_version )
+	{
+		msg << strfname << " is not a trace file!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		tr_file.close();
+		return false;
+	}
+	tr_header.channel_count		= (unsigned int)read_uint(tr_file, 4);
+	tr_header.dataset_length	= (unsigned int)read_uint(tr_file, 4);
+	tr_header.sample_period		= read_uint(tr_file, 8);
+	tr_header.sample_type		= (unsigned int)read_uint(tr_file, 4);
+	read_uint(tr_file, 4);														// reserved
+	tr_header.block_count		= read_uint(tr_file, 8);
+	tr_header.index_offset		= read_uint(tr_file, 8);
+
+	tr_name			= file_name;
+	tr_block_size	= 8 + sc_dt::uint64(tr_header.channel_count) * tr_header.dataset_length;
+	tr_next			= 0;
+	return tr_blocks.open( file_name, trace_header_size );
+}
+
+
+//======================================================================
+/// @fn close
+//
+/// @brief closes the trace file
+//
+//======================================================================
+void trace_reader::close ( void )
+{
+	tr_blocks.close();
+	if ( tr_file.is_open() )
+	{
+		tr_file.close();
+	}
+}
+
+
+//======================================================================
+/// @fn seek
+//
+/// @brief positions the reader on the first block whose timestamp isn't 
+///		lower than the given time.
+//
+/// @details The index is searched by bisection directly in the file. At
+///		most #trace_index_stride timestamps are then read to find the block,
+///		and the streaming of the blocks restarts at its offset.
+//
+/// @retval false if there is no such block
+//
+//======================================================================
+bool trace_reader::seek ( const sc_core::sc_time& time )
+{
+	sc_dt::uint64	time_ps		= to_ps(time);
+	sc_dt::uint64	entries		= ( tr_header.block_count + trace_index_stride - 1 ) / trace_index_stride;
+	sc_dt::uint64	low			= 0;
+	sc_dt::uint64	high		= entries;
+	sc_dt::uint64	block;
+
+	// last index entry whose timestamp isn't greater than time
+	while ( high - low > 1 )
+	{
+		sc_dt::uint64 mid = (low + high) / 2;
+		tr_file.seekg( std::streamoff(tr_header.index_offset + mid * 8) );
+		if ( read_uint(tr_file, 8) <= time_ps )
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	block = low * trace_index_stride;
+	while ( block < tr_header.block_count && block_time(block) < time_ps )
+	{
+		block++;
+	}
+
+	tr_next = block;
+	if ( block >= tr_header.block_count )
+	{
+		tr_blocks.close();
+		return false;
+	}
+	return tr_blocks.open( tr_name.c_str(), trace_header_size + block * tr_block_size );
+}
+
+
+//======================================================================
+/// @fn next_block
+//
+/// @brief reads the next block of the trace
+//
+/// @details The datasets of the channels are copied one after the other
+///		into the given buffer.
+//
+/// @retval false at the end of the trace
+//
+//======================================================================
+bool trace_reader::next_block ( sc_core::sc_time& time, datyp* data )
+{
+	unsigned char	stamp[8];
+	size_t			length	= size_t(tr_block_size - 8);
+
+	if ( tr_next >= tr_header.block_count )
+	{
+		return false;
+	}
+	if ( tr_blocks.read(stamp, 8) < 8 || tr_blocks.read(data, length) < length )
+	{
+		return false;
+	}
+	time = sc_core::sc_time( double(get_uint(stamp, 8)), sc_core::SC_PS );
+	tr_next++;
+	return true;
+}
+
+
+const trace_header& trace_reader::header ( void ) const
+{
+	return tr_header;
+}
+
+
+//======================================================================
+/// @fn block_time
+//
+/// @brief reads the timestamp of a block
+//
+//======================================================================
+sc_dt::uint64 trace_reader::block_time ( sc_dt::uint64 block )
+{
+	tr_file.seekg( std::streamoff(trace_header_size + block * tr_block_size) );
+	return read_uint(tr_file, 8);
+}
+
+
+//======================================================================
+/// @fn is_trace
+//
+/// @brief checks whether a file starts with the magic bytes of a trace
+//
+//======================================================================
+bool trace_reader::is_trace ( const char* file_name )
+{
+	std::string		strfname = std::string(INPUTDIR) + std::string(file_name);
+	std::ifstream	infile( strfname.c_str(), std::ifstream::binary );
+	char			magic[4];
+
+	infile.read( magic, 4 );
+	return infile.good() && memcmp(magic, trace_magic, 4) == 0;
+}
+
+
+//======================================================================
+/// @fn trace_writer
+//
+/// @brief constructor
+//
+//======================================================================
+trace_writer::trace_writer ( void )
+{
+	memset( &tw_header, 0, sizeof(tw_header) );
+}
+
+
+//======================================================================
+/// @fn ~trace_writer
+//
+/// @brief destructor. It completes the file if it is still open.
+//
+//======================================================================
+trace_writer::~trace_writer ( void )
+{
+	close();
+}
+
+
+//======================================================================
+/// @fn open
+//
+/// @brief creates a trace file
+//
+/// @details The header is completed by close(), once the number of 
+///		blocks and the position of the index are known.
+//
+//======================================================================
+bool trace_writer::open ( const char* file_name, 
+						  unsigned int channel_count, 
+						  unsigned int dataset_length, 
+						  sc_core::sc_time sample_period, 
+						  trace_sample_type sample_type )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(INPUTDIR) + std::string(file_name);
+
+	close();
+	tw_file.clear();
+	tw_file.open( strfname.c_str(), std::ofstream::binary | std::ofstream::trunc );
+	if ( !tw_file.is_open() )
+	{
+		msg << "i couldn't create file " << strfname << "!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		return false;
+	}
+
+	tw_header.channel_count		= channel_count;
+	tw_header.dataset_length	= dataset_length;
+	tw_header.sample_period		= to_ps(sample_period);
+	tw_header.sample_type		= sample_type;
+	tw_header.block_count		= 0;
+	tw_header.index_offset		= 0;
+	tw_index.clear();
+
+	tw_file.write( std::string(size_t(trace_header_size), '\0').data(), std::streamsize(trace_header_size) );
+	return tw_file.good();
+}
+
+
+//======================================================================
+/// @fn write_block
+//
+/// @brief appends a block to the trace
+//
+/// @details The timestamps must be increasing.
+//
+//======================================================================
+bool trace_writer::write_block ( sc_core::sc_time time, const datyp* data )
+{
+	sc_dt::uint64	stamp	= to_ps(time);
+
+	if ( tw_header.block_count % trace_index_stride == 0 )
+	{
+		tw_index.push_back(stamp);
+	}
+	put_uint( tw_file, stamp, 8 );
+	tw_file.write( reinterpret_cast<const char*>(data), std::streamsize(tw_header.channel_count) * tw_header.dataset_length );
+	tw_header.block_count++;
+	return tw_file.good();
+}
+
+
+//======================================================================
+/// @fn close
+//
+/// @brief writes the index and the header and closes the file
+//
+//======================================================================
+bool trace_writer::close ( void )
+{
+	bool	ok;
+
+	if ( !tw_file.is_open() )
+	{
+		return true;
+	}
+
+	tw_header.index_offset = sc_dt::uint64( tw_file.tellp() );
+	for ( unsigned int i = 0; i < tw_index.size(); i++ )
+	{
+		put_uint( tw_file, tw_index[i], 8 );
+	}
+
+	tw_file.seekp(0);
+	tw_file.write( trace_magic, 4 );
+	put_uint( tw_file, trace_version,				4 );
+	put_uint( tw_file, tw_header.channel_count,		4 );
+	put_uint( tw_file, tw_header.dataset_length,	4 );
+	put_uint( tw_file, tw_header.sample_period,		8 );
+	put_uint( tw_file, tw_header.sample_type,		4 );
+	put_uint( tw_file, 0,							4 );						// reserved
+	put_uint( tw_file, tw_header.block_count,		8 );
+	put_uint( tw_file, tw_header.index_offset,		8 );
+
+	ok = tw_file.good();
+	tw_file.close();
+	return ok;
+}
+
+
+namespace file_ops
+{
+
+//======================================================================
+/// @fn convert_to_trace
+//
+/// @brief converts the input files of the channels of a node into one 
+///		trace file.
+//
+/// @details The files are read as streams. Block n has the timestamp
+///		n * sample_period and holds the n-th dataset of each channel. The
+///		conversion ends with the shortest file. In text mode, the whitespace
+///		characters are skipped like file_ops::read_out_file() does.
+//
+//======================================================================
+	bool convert_to_trace	( const std::vector<std::string>& channel_files,
+							  const char* trace_file,
+							  unsigned int dataset_length,
+							  sc_core::sc_time sample_period,
+							  bool text_input	)
+	{
+		std::vector<stream_reader*>	readers;
+		std::vector<datyp>			block( channel_files.size() * dataset_length );
+		trace_writer				writer;
+		bool						ok		= true;
+		bool						more	= true;
+		sc_dt::uint64				n		= 0;
+
+		for ( unsigned int i = 0; i < channel_files.size(); i++ )
+		{
+			readers.push_back( new stream_reader() );
+			ok = ok && readers[i]->open( channel_files[i].c_str() );
+		}
+		ok = ok && writer.open( trace_file, (unsigned int)channel_files.size(), dataset_length, sample_period, TRACE_UINT8 );
+
+		while ( ok && more && !block.empty() )
+		{
+			for ( unsigned int i = 0; more && i < readers.size(); i++ )
+			{
+				datyp* dataset = &block[i * dataset_length];
+				if ( text_input )
+				{
+					for ( unsigned int j = 0; more && j < dataset_length; j++ )
+					{
+						do
+						{
+							more = readers[i]->next( dataset[j] );
+						} while ( more && isspace(dataset[j]) );
+					}
+				}
+				else
+				{
+					more = readers[i]->read( dataset, dataset_length ) == dataset_length;
+				}
+			}
+			if ( more )
+			{
+				ok = writer.write_block( sample_period * double(n), &block[0] );
+				n++;
+			}
+		}
+		ok = writer.close() && ok;
+
+		for ( unsigned int i = 0; i < readers.size(); i++ )
+		{
+			delete readers[i];
+		}
+		return ok;
+	}
+}
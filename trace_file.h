@@ -0,0 +1,165 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file trace_file.h
+//
+///  @brief This is the indexed binary format for multi-channel sensor traces
+//
+///  @details
+///		A trace file feeds all the senenv components of a node. It consists of:
+///		- a header with the number of channels, the dataset length, the sample
+///		  period and the sample type,
+///		- fixed size blocks, each one made of a timestamp followed by one dataset
+///		  per channel,
+///		- an index with the timestamp of every #trace_index_stride-th block, so 
+///		  that a run can start at any simulated time without scanning the file.
+///
+///		Times are stored in picoseconds and all fields are little-endian. <br>
+///		The blocks are read through a stream_reader, so the memory used doesn't
+///		depend on the length of the trace. file_ops::convert_to_trace() converts
+///		the byte and text input files used so far.
+//		
+//==============================================================================
+
+#ifndef __TRACE_FILE_H__
+#define __TRACE_FILE_H__
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <systemc.h>
+
+#include "constants.h"
+#include "stream_reader.h"
+
+/// type of the samples of a trace (information for the user of the data)
+enum trace_sample_type
+{
+	TRACE_UINT8		= 0,
+	TRACE_INT16		= 1,
+	TRACE_INT32		= 2,
+	TRACE_FLOAT32	= 3
+};
+
+/// header of a trace file
+struct trace_header
+{
+	unsigned int		channel_count;										///< number of channels (one per senenv component)
+	unsigned int		dataset_length;										///< length of the dataset of a channel in each block (bytes)
+	sc_dt::uint64		sample_period;										///< nominal time between two blocks (ps)
+	unsigned int		sample_type;										///< trace_sample_type of the samples
+	sc_dt::uint64		block_count;										///< number of blocks
+	sc_dt::uint64		index_offset;										///< position of the index in the file
+};
+
+
+class trace_reader
+{
+
+// Member Methods  ====================================================
+public:
+
+	trace_reader	( void );
+
+	bool open		( const char* file_name									///< trace file name, relative to INPUTDIR
+					);
+
+	void close		( void );
+
+	bool seek		( const sc_core::sc_time& time							///< simulated time of the first block to be read
+					);
+
+	bool next_block	( sc_core::sc_time& time,								///< ref to the timestamp of the block
+					  datyp* data											///< pointer to a buffer of channel_count * dataset_length values
+					);
+
+	const trace_header& header		( void ) const;
+
+	static bool is_trace			( const char* file_name					///< file name, relative to INPUTDIR
+									);
+
+// Member Variables/Objects  ===================================================
+private:
+
+	sc_dt::uint64 block_time		( sc_dt::uint64 block					///< block number
+									);
+
+	std::string			tr_name;											///< trace file name
+	std::ifstream		tr_file;											///< header, index and timestamp lookups
+	stream_reader		tr_blocks;											///< streaming of the blocks
+	trace_header		tr_header;
+	sc_dt::uint64		tr_block_size;										///< size of a block including its timestamp (bytes)
+	sc_dt::uint64		tr_next;											///< number of the next block to be read
+};
+
+
+class trace_writer
+{
+
+// Member Methods  ====================================================
+public:
+
+	trace_writer	( void );
+
+	~trace_writer	( void );
+
+	bool open		( const char* file_name,								///< trace file name, relative to INPUTDIR
+					  unsigned int channel_count,							///< number of channels
+					  unsigned int dataset_length,							///< length of the dataset of a channel (bytes)
+					  sc_core::sc_time sample_period,						///< nominal time between two blocks
+					  trace_sample_type sample_type							///< type of the samples
+					);
+
+	bool write_block( sc_core::sc_time time,								///< timestamp of the block
+					  const datyp* data										///< pointer to channel_count * dataset_length values
+					);
+
+	bool close		( void );
+
+// Member Variables/Objects  ===================================================
+private:
+
+	std::ofstream					tw_file;
+	trace_header					tw_header;
+	std::vector<sc_dt::uint64>		tw_index;								///< timestamps of the indexed blocks (ps)
+};
+
+
+namespace file_ops
+{
+	bool convert_to_trace	( const std::vector<std::string>& channel_files,	///< byte or text file of each channel, relative to INPUTDIR
+							  const char* trace_file,							///< trace file name, relative to INPUTDIR
+							  unsigned int dataset_length,						///< length of the dataset of a channel (bytes)
+							  sc_core::sc_time sample_period,					///< time between two blocks
+							  bool text_input									///< skips the whitespaces like the former text reading
+							);
+}
+
+#endif /*__TRACE_FILE_H__*/
@@ -0,0 +1,303 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+
+#include "traffic_log.h"
+#include "key_functions.h"
+#include "reporting.h"
+
+static const char	*filename		= "traffic_log.cpp";
+static const char	*suffix			= "traffic.bin";
+static const char	traffic_magic[4]	= { 'P', 'S', 'R', 'L' };		///< first bytes of a traffic log
+
+
+//======================================================================
+/// @fn put_varint
+//
+/// @brief writes a value with 7 bits per byte, lowest bits first
+//
+//======================================================================
+static void put_varint ( std::ostream& os, sc_dt::uint64 value )
+{
+	while ( value >= 0x80 )
+	{
+		os.put( char( (value & 0x7f) | 0x80 ) );
+		value >>= 7;
+	}
+	os.put( char(value) );
+}
+
+
+//======================================================================
+/// @fn now_ps
+//
+/// @brief returns the current simulated time in picoseconds
+//
+/// @details The time is computed in integers from the ticks of the time 
+///		resolution, so that it stays exact beyond the 53 bits of a double.
+///		A resolution finer than 1 ps is rounded to the nearest picosecond.
+//
+//======================================================================
+static sc_dt::uint64 now_ps ( void )
+{
+	const sc_core::sc_time	one_ps	( 1, sc_core::SC_PS );
+	sc_dt::uint64			ticks	= sc_core::sc_time_stamp().value();
+
+	if ( sc_core::sc_get_time_resolution() >= one_ps )
+	{
+		// the resolution is a power of ten of at least 1 ps
+		return ticks * sc_dt::uint64( sc_core::sc_get_time_resolution().to_seconds() * 1e12 + 0.5 );
+	}
+	return ( ticks + one_ps.value()/2 ) / one_ps.value();
+}
+
+
+//======================================================================
+/// @fn traffic_recorder
+//
+/// @brief constructor
+//
+//======================================================================
+traffic_recorder::traffic_recorder ( void )
+	: tr_last_time	( 0 )
+{
+}
+
+
+//======================================================================
+/// @fn ~traffic_recorder
+//
+/// @brief destructor. It closes the log.
+//
+//======================================================================
+traffic_recorder::~traffic_recorder ( void )
+{
+	close();
+}
+
+
+//======================================================================
+/// @fn open
+//
+/// @brief creates the log file of a node in OUTPUTDIR
+//
+//======================================================================
+bool traffic_recorder::open ( std::string name )
+{
+	std::ostringstream	msg;
+	std::string			strfname = std::string(OUTPUTDIR) + file_ops::build_filename(name, suffix);
+
+	close();
+	tr_file.clear();
+	tr_file.open( strfname.c_str(), std::ofstream::binary | std::ofstream::trunc );
+	if ( !tr_file.is_open() )
+	{
+		msg << "i couldn't create file " << strfname << "!";
+		ERROR_LOG(filename, __FUNCTION__, msg.str());
+		return false;
+	}
+	tr_file.write( traffic_magic, 4 );
+	tr_last_time = 0;
+	return true;
+}
+
+
+//======================================================================
+/// @fn record
+//
+/// @brief writes the record of a message with the current simulated time
+//
+//======================================================================
+void traffic_recorder::record ( unsigned int channel, const sc_dt::uchar* data, unsigned int length )
+{
+	sc_dt::uint64	time	= now_ps();
+
+	if ( !tr_file.is_open() )
+	{
+		return;
+	}
+	put_varint( tr_file, time - tr_last_time );
+	put_varint( tr_file, channel );
+	put_varint( tr_file, length );
+	tr_file.write( reinterpret_cast<const char*>(data), std::streamsize(length) );
+	tr_last_time = time;
+}
+
+
+//======================================================================
+/// @fn close
+//
+/// @brief closes the log
+//
+//======================================================================
+void traffic_recorder::close ( void )
+{
+	if ( tr_file.is_open() )
+	{
+		tr_file.close();
+	}
+}
+
+
+//======================================================================
+/// @fn recording_fifo
+//
+/// @brief constructor. The recording is disabled until set_recorder().
+//
+//======================================================================
+recording_fifo::recording_fifo ( const char* name_, unsigned int size_ )
+	: message_fifo	( name_, size_ )
+	, rf_recorder	( 0 )
+	, rf_channel	( 0 )
+{
+}
+
+
+void recording_fifo::set_recorder ( traffic_recorder* recorder, unsigned int channel )
+{
+	rf_recorder	= recorder;
+	rf_channel	= channel;
+}
+
+
+bool recording_fifo::nb_write_msg ( const sc_dt::uchar* data, unsigned int length )
+{
+	if ( !message_fifo::nb_write_msg(data, length) )
+	{
+		return false;
+	}
+	if ( rf_recorder )
+	{
+		rf_recorder->record(rf_channel, data, length);
+	}
+	return true;
+}
+
+
+//======================================================================
+/// @fn traffic_replay
+//
+/// @brief constructor
+//
+/// @details It opens the log and checks its header.
+//
+//======================================================================
+traffic_replay::traffic_replay	( sc_core::sc_module_name module_name
+								, unsigned int out_port_nr
+								, const char* log_file			)
+	: sc_core::sc_module( module_name )
+	, out_ports	( "replay_port" )
+	, rp_valid	( false )
+{
+	std::ostringstream	msg;
+	datyp				magic[4];
+
+	out_ports.init(out_port_nr);
+	SC_THREAD(replay_thread);
+
+	if ( rp_reader.open(log_file) )
+	{
+		rp_valid = rp_reader.read(magic, 4) == 4 && memcmp(magic, traffic_magic, 4) == 0;
+		if ( !rp_valid )
+		{
+			msg << log_file << " is not a traffic log!";
+			ERROR_LOG(filename, __FUNCTION__, msg.str());
+		}
+	}
+}
+
+
+//======================================================================
+/// @fn replay_thread
+//
+/// @brief thread process writing the recorded bytes
+//
+/// @details It waits until the recorded time of each record and writes
+///		its message into the fifo of the recorded index.
+//
+//======================================================================
+void traffic_replay::replay_thread ( void )
+{
+	std::ostringstream		msg;
+	std::vector<datyp>		bytes;
+	sc_dt::uint64			time	= 0;
+	sc_dt::uint64			delta, channel, length;
+	sc_core::sc_time		at;
+
+	while ( rp_valid && read_varint(delta) && read_varint(channel) && read_varint(length) )
+	{
+		time += delta;
+		bytes.resize( size_t(length) );
+		if ( length > 0 && rp_reader.read(&bytes[0], size_t(length)) < length )
+		{
+			break;
+		}
+
+		at = sc_core::sc_time( double(time), sc_core::SC_PS );
+		if ( at > sc_core::sc_time_stamp() )
+		{
+			wait( at - sc_core::sc_time_stamp() );
+		}
+
+		if ( channel >= out_ports.size() )
+		{
+			msg.str("");
+			msg << "no port for the recorded fifo " << channel << "!";
+			WARNING_LOG(filename, __FUNCTION__, msg.str());
+			continue;
+		}
+		out_ports[size_t(channel)]->write_msg( bytes.empty() ? 0 : &bytes[0], (unsigned int)bytes.size() );
+	}
+}
+
+
+//======================================================================
+/// @fn read_varint
+//
+/// @brief reads a value written by put_varint()
+//
+//======================================================================
+bool traffic_replay::read_varint ( sc_dt::uint64& value )
+{
+	datyp			byte;
+	unsigned int	shift	= 0;
+
+	value = 0;
+	do
+	{
+		if ( !rp_reader.next(byte) )
+		{
+			return false;
+		}
+		value |= sc_dt::uint64(byte & 0x7f) << shift;
+		shift += 7;
+	} while ( byte & 0x80 );
+	return true;
+}
@@ -0,0 +1,133 @@
+/*
+*
+* Author: Tatiana Djaba Nya (Lead author)
+* Author: Stephan C. Stilkerich
+*
+* Reference Architecture Model (EPiCS FP7 FET program, No. 257906)
+*           - Peter R. Lewis, University of Birmingham 
+*           - Xin Yao, University of Birmingham
+*
+* Copyright (c) 2013, EADS Deutschland GmbH, EADS Innovation Works
+*
+*==============================================================================
+*
+*This file is part of ProprioSimEnv.
+*
+*    ProprioSimEnv is free software: you can redistribute it and/or modify
+*    it under the terms of the GNU General Public License as published by
+*    the Free Software Foundation, either version 3 of the License, or
+*    (at your option) any later version.
+*
+*    ProprioSimEnv is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU General Public License for more details.
+*
+*    You should have received a copy of the GNU General Public License
+*    along with ProprioSimEnv.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//==============================================================================
+///  @file traffic_log.h
+//
+///  @brief This is the record and replay of the traffic between the nodes
+//
+///  @details
+///		A traffic_recorder logs every message written into the output fifos of a 
+///		node (recording_fifo) with its simulated time and the index of its fifo. 
+///		Each message is one record: varint time delta (ps), varint fifo index, 
+///		varint length, bytes. <br>
+///		A traffic_replay module feeds the input ports of a single node from such a
+///		log, writing each message at its recorded simulated time, so that the node 
+///		can be simulated without the rest of the system.
+//		
+//==============================================================================
+
+#ifndef __TRAFFIC_LOG_H__
+#define __TRAFFIC_LOG_H__
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <systemc.h>
+
+#include "constants.h"
+#include "stream_reader.h"
+#include "message_fifo.h"
+
+
+class traffic_recorder
+{
+public:
+
+	traffic_recorder	( void );
+
+	~traffic_recorder	( void );
+
+	bool open			( std::string name								///< node name, prefix of the log file
+						);
+
+	void record			( unsigned int channel,							///< index of the output fifo
+						  const sc_dt::uchar* data,						///< message written into the fifo
+						  unsigned int length							///< length of the message
+						);
+
+	void close			( void );
+
+private:
+
+	std::ofstream				tr_file;
+	sc_dt::uint64				tr_last_time;							///< time of the last record written (ps)
+};
+
+
+//======================================================================
+/// @class recording_fifo
+//
+/// @brief message fifo which reports the messages written into it to a recorder
+//
+//======================================================================
+class recording_fifo : public message_fifo
+{
+public:
+
+	explicit recording_fifo	( const char* name_, unsigned int size_ = message_fifo_size );
+
+	void set_recorder		( traffic_recorder* recorder,				///< recorder of the node, 0 to disable the recording
+							  unsigned int channel						///< index of the fifo in the log
+							);
+
+	/// also used by the blocking write_msg() of message_fifo
+	bool nb_write_msg		( const sc_dt::uchar* data, unsigned int length );
+
+private:
+
+	traffic_recorder			*rf_recorder;
+	unsigned int				rf_channel;
+};
+
+
+class traffic_replay : public sc_core::sc_module
+{
+public:
+
+	traffic_replay		( sc_core::sc_module_name module_name,			///< sc module name
+						  unsigned int out_port_nr,						///< number of output ports (recorded fifos)
+						  const char* log_file							///< log file name, relative to INPUTDIR
+						);
+
+	SC_HAS_PROCESS( traffic_replay );
+
+	void replay_thread	( void );
+
+	sc_core::sc_vector< sc_core::sc_port< message_fifo_out_if > >	out_ports;	///< output ports, bound to the fifos feeding the input ports of the node
+
+private:
+
+	bool read_varint	( sc_dt::uint64& value );
+
+	stream_reader				rp_reader;								///< streaming reader of the log
+	bool						rp_valid;								///< the log has been opened and its header checked
+};
+
+#endif /*__TRAFFIC_LOG_H__*/